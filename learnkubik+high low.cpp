@@ -13,582 +13,561 @@
 #include <iostream>
 #include <string>
 #include <vector>
-#include <random>
 #include <algorithm>
 #include <iomanip>
 #include <cctype>
-#include <map>
 #include <cstdlib>
+#include <cstring>
 #include <sstream>
-#include <limits>
-#include <fstream> // Untuk file I/O (papan peringkat)
-
-// Header spesifik platform untuk input langsung
+#include <chrono>
+#include <memory>
+#include <fstream>
+
+#include "symbolic_core.h" // Logika permainan tanpa konsol
+#include "symbolic_screen.h" // Layar ganda dengan diff per frame
+#include "symbolic_broadcast.h" // Siaran frame ke penonton lewat memori bersama
+#include "symbolic_board.h" // Penyusun tampilan papan (atlas glif, bingkai)
+#include "symbolic_render.h" // Thread render: tombol tidak pernah menunggu terminal
+#include "symbolic_candidates.h" // Angka yang masih mungkin setelah setiap tebakan
+#include "symbolic_solver.h" // Pencari tebakan terbaik untuk petunjuk
+#include "symbolic_book.h" // Buku pembukaan: tebakan awal tanpa mencari ulang
+#include "symbolic_calibration.h" // Tabel pengali skor per tingkat kesulitan
+#include "symbolic_leaderboard.h" // Papan peringkat biner (log + indeks)
+#include "symbolic_terminal.h" // Raw mode sekali, input + timer lewat poll
+#include "symbolic_trace.h" // Histogram latensi per fase dan trace Chrome
+#include "symbolic_recording.h" // Rekaman biner setiap permainan untuk diputar ulang
+#include "symbolic_alloc.h" // Jumlah alokasi heap per fase (build instrumentasi)
+
+// Header spesifik platform untuk ukuran terminal
 #ifdef _WIN32
-#include <conio.h>
 #include <windows.h>
 #else
-#include <termios.h>
+#include <sys/ioctl.h>
 #include <unistd.h>
 #endif
 
 using namespace std;
 
-// Struktur untuk menyimpan data di papan peringkat
-struct ScoreEntry {
-    string playerName;
-    int score;
-    int digits;
-    int attempts;
-};
-
-// Deklarasi fungsi pembantu
-int getIntegerInput(const string& prompt, int min, int max);
-
 /*
  * DEFINISI KELAS UTAMA PERMAINAN
  */
 class SymbolicNumbler {
 private:
     // VARIABEL STATUS PERMAINAN
-    string target;
-    vector<string> guesses;
-    vector<string> results;
-    int maxAttempts;
-    int currentAttempt;
-    int digits;
+    GameCore core;
+    Rng rng = Rng::fromEnvironment(); // SYMBOLIC_SEED=N: urutan target bisa diulang
 
     // DATA PAPAN PERINGKAT
-    vector<ScoreEntry> leaderboard;
-    const string leaderboardFilename = "symbolic_leaderboard.txt";
-
-    // KONSTANTA WARNA ANSI
-    static constexpr const char* GREEN = "\033[32m";
-    static constexpr const char* YELLOW = "\033[33m";
-    static constexpr const char* RED = "\033[31m";
-    static constexpr const char* CYAN = "\033[36m";
-    static constexpr const char* MAGENTA = "\033[35m";
-    static constexpr const char* RESET = "\033[0m";
-
-    int BORDER_WIDTH = 80;
-
-    // PEMETAAN SIMBOL DIGIT ASCII
-    const map<char, string> digitSymbols = {
-        {'0', " ##### \n##   ##\n##   ##\n##   ##\n##   ##\n##   ##\n ##### "},
-        {'1', "   ##  \n ####  \n   ##  \n   ##  \n   ##  \n   ##  \n#######"},
-        {'2', " ##### \n##   ##\n     ##\n ##### \n##     \n##     \n#######"},
-        {'3', " ##### \n##   ##\n     ##\n ##### \n     ##\n##   ##\n ##### "},
-        {'4', "##   ##\n##   ##\n##   ##\n#######\n     ##\n     ##\n     ##"},
-        {'5', "#######\n##     \n##     \n###### \n     ##\n##   ##\n ##### "},
-        {'6', " ##### \n##   ##\n##     \n###### \n##   ##\n##   ##\n ##### "},
-        {'7', "#######\n     ##\n    ## \n   ##  \n  ##   \n ##    \n ##    "},
-        {'8', " ##### \n##   ##\n##   ##\n ##### \n##   ##\n##   ##\n ##### "},
-        {'9', " ##### \n##   ##\n##   ##\n ######\n     ##\n##   ##\n ##### "}
-    };
-
-    // SIMBOL PANAH ASCII UNTUK PETUNJUK
-    const map<string, string> arrowSymbols = {
-        {"UP",
-         "   ##   \n"
-         "  ####  \n"
-         " ###### \n"
-         "   ##   \n"
-         "   ##   \n"
-         "   ##   \n"
-         "   ##   "},
-        {"DOWN",
-         "   ##   \n"
-         "   ##   \n"
-         "   ##   \n"
-         "   ##   \n"
-         " ###### \n"
-         "  ####  \n"
-         "   ##   "}
-    };
-
-    // Menghitung panjang visual (mengabaikan kode warna ANSI)
-    int getVisualLength(const string& text) {
-        int length = 0;
-        bool inColorCode = false;
-        for (char c : text) {
-            if (c == '\033') {
-                inColorCode = true;
-            } else if (inColorCode && c == 'm') {
-                inColorCode = false;
-            } else if (!inColorCode) {
-                length++;
-            }
-        }
-        return length;
-    }
-
-    // Menghitung skor berdasarkan sisa percobaan dan jumlah digit
-    int calculateScore() {
-        return (maxAttempts - currentAttempt + 1) * digits * 50;
+    LeaderboardStore leaderboard;
+    static constexpr size_t LEADERBOARD_ROWS = 10;
+
+    // SIARAN: SYMBOLIC_BROADCAST=FILE (atau 1 untuk path bawaan) mengirim setiap frame
+    // ke penonton symbolic_watch. Dideklarasikan sebelum layar yang memakainya.
+    BroadcastPublisher broadcast;
+
+    // Menu, instruksi dan hasil disusun ke layar ini lalu dikirim sekali per frame
+    ScreenBuffer screen;
+    BoardRenderer board{screen};
+    int columns = 0; // Lebar terminal saat permainan dimulai
+    int rows = 0;    // Tinggi terminal; frame dipotong agar muat
+
+    // Petunjuk terakhir dari pencari (kosong jika belum diminta)
+    string hintText;
+    static constexpr int HINT_BUDGET_MS = 300;
+
+    // BUKU PEMBUKAAN: SYMBOLIC_BOOK=FILE mengganti file (bawaan: symbolic_book.bin).
+    // Tidak ada file berarti semua petunjuk dicari langsung.
+    OpeningBook book;
+
+    // Angka yang masih mungkin, disaring per tebakan; tombol K menampilkan contohnya
+    CandidateTracker candidates;
+    static constexpr size_t CANDIDATES_SHOWN = 6;
+
+    // INPUT: satu sesi raw mode untuk seluruh program
+    TerminalSession terminal;
+
+    // MODE SPEEDRUN: jam dimulai saat papan pertama muncul
+    using Clock = TerminalSession::Clock;
+    bool timed = false;
+    Clock::time_point startedAt;
+    Clock::time_point submittedAt; // Cap waktu tombol Enter tebakan terakhir
+    static constexpr int CLOCK_TIMER = 1;
+    static constexpr int CLOCK_TICK_MS = 100;
+
+    // PELACAKAN LATENSI: tombol T menampilkan p50/p99/maks di bawah papan
+    bool showLatency = false;
+    vector<Clock::time_point> pendingKeys; // Cap waktu tombol yang belum tampil di frame
+
+    // REKAMAN: SYMBOLIC_RECORD=0 mematikan, SYMBOLIC_RECORD=FILE mengganti file tujuan
+    unique_ptr<RecordingWriter> recorder;
+    int64_t gameStartedAt = 0;  // Milidetik sejak epoch
+    vector<uint32_t> guessMs;   // Waktu setiap tebakan sejak papan muncul
+
+    // AKUNTANSI ALOKASI: di build -DSYMBOLIC_ALLOC_ACCOUNTING=ON, SYMBOLIC_ALLOC_REPORT=FILE
+    // menambahkan alokasi per fase, per tombol dan per permainan ke FILE setelah setiap permainan
+    AllocTracker allocs;
+    string allocReportPath;
+    int gamesPlayed = 0;
+
+    // RENDER: papan saat menebak digambar thread sendiri dari snapshot terbaru.
+    // Dideklarasikan terakhir agar thread-nya berhenti sebelum terminal dipulihkan.
+    BoardPresenter presenter;
+
+    int64_t elapsedMs(Clock::time_point at) const {
+        return chrono::duration_cast<chrono::milliseconds>(at - startedAt).count();
     }
 
 public:
     // FUNGSI UTILITAS (STATIC)
 #ifdef _WIN32
-    static char getChar() { return _getch(); }
-    static void clearScreen() { system("cls"); }
-#else
-    static char getChar() {
-        char buf = 0;
-        struct termios old = {0};
-        fflush(stdout);
-        tcgetattr(0, &old);
-        old.c_lflag &= ~ICANON;
-        old.c_lflag &= ~ECHO;
-        old.c_cc[VMIN] = 1;
-        old.c_cc[VTIME] = 0;
-        tcsetattr(0, TCSANOW, &old);
-        if (read(0, &buf, 1) < 0) perror("read()");
-        old.c_lflag |= ICANON;
-        old.c_lflag |= ECHO;
-        tcsetattr(0, TCSADRAIN, &old);
-        return buf;
+    static int getTerminalColumns() {
+        CONSOLE_SCREEN_BUFFER_INFO info;
+        if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) return 0;
+        return info.srWindow.Right - info.srWindow.Left + 1;
     }
-    static void clearScreen() { cout << "\033[2J\033[1;1H"; }
-#endif
 
-    // FUNGSI JEDA
-    void pauseForInput() {
-        cout << "\nTekan tombol apa saja untuk melanjutkan...";
-        getChar();
+    static int getTerminalRows() {
+        CONSOLE_SCREEN_BUFFER_INFO info;
+        if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) return 0;
+        return info.srWindow.Bottom - info.srWindow.Top + 1;
     }
-
-    // KONSTRUKTOR
-    SymbolicNumbler(int initial_digits = 4, int initial_attempts = 6) {
-        startNewGame(initial_digits, initial_attempts);
-        loadLeaderboard();
-    }
-
-    // Memulai atau mereset permainan dengan pengaturan baru
-    void startNewGame(int newDigits, int newAttempts) {
-        digits = newDigits;
-        maxAttempts = newAttempts;
-        currentAttempt = 0;
-        guesses.clear();
-        results.clear();
-        BORDER_WIDTH = max(80, digits * 10 + 20);
-        generateTarget(digits);
+#else
+    // Lebar terminal dalam kolom, 0 jika tidak diketahui (misalnya bukan TTY)
+    static int getTerminalColumns() {
+        struct winsize size;
+        if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) < 0) return 0;
+        return size.ws_col;
     }
 
-    // Membuat angka target acak
-    void generateTarget(int numDigits) {
-        random_device rd;
-        mt19937 gen(rd());
-        uniform_int_distribution<> dis(0, 9);
-        target = "";
-        for (int i = 0; i < numDigits; i++) {
-            target += to_string(dis(gen));
-        }
+    // Tinggi terminal dalam baris, 0 jika tidak diketahui
+    static int getTerminalRows() {
+        struct winsize size;
+        if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) < 0) return 0;
+        return size.ws_row;
     }
+#endif
 
-    // FUNGSI TAMPILAN (BORDER, TEKS, DLL.)
-    void printBorder(bool top = false, bool bottom = false) {
-        cout << CYAN;
-        char borderChar = (top || bottom) ? '=' : '-';
-        cout << "+";
-        for (int i = 0; i < BORDER_WIDTH - 2; i++) cout << borderChar;
-        cout << "+";
-        cout << RESET << "\n";
+    // Menunggu satu tombol; '\0' jika input sudah ditutup
+    char readKey() {
+        cout.flush();
+        return terminal.readKey();
     }
 
-    void printInBorder(const string& text, bool center = true) {
-        cout << CYAN << "|" << RESET;
-        int visibleLength = getVisualLength(text);
-        int padding = BORDER_WIDTH - 2 - visibleLength;
-        if (center) {
-            int leftPad = padding / 2;
-            int rightPad = padding - leftPad;
-            cout << string(leftPad, ' ') << text << string(rightPad, ' ');
-        } else {
-            cout << " " << text << string(padding - 1, ' ');
-        }
-        cout << CYAN << "|" << RESET << "\n";
+    // FUNGSI JEDA
+    void pauseForInput() {
+        cout << "\nTekan tombol apa saja untuk melanjutkan...";
+        readKey();
     }
 
-    void printEmptyBorderLine() {
-        cout << CYAN << "|" << string(BORDER_WIDTH - 2, ' ') << "|" << RESET << "\n";
+    // Jeda tanpa membakar CPU; tombol yang ditekan selama jeda tidak hilang
+    void pause(chrono::milliseconds delay) {
+        cout.flush();
+        terminal.sleepFor(delay);
     }
 
-    // Menampilkan angka dalam bentuk seni ASCII
-    void displaySymbolicNumber(const string& number, const string& feedback = "", bool isInput = false) {
-        vector<vector<string>> symbolLines(7);
-        for (char digitChar : number) {
-            if (!isdigit(digitChar)) continue;
-
-            stringstream ss(digitSymbols.at(digitChar));
-            string line;
-            vector<string> lines;
-            while (getline(ss, line, '\n')) lines.push_back(line);
-
-            string color = RESET;
-            if (isInput) color = MAGENTA;
-            else if (!feedback.empty() && (symbolLines[0].size() < feedback.length())) {
-                switch (feedback[symbolLines[0].size()]) {
-                    case 'G': color = GREEN; break;
-                    case 'Y': color = YELLOW; break;
-                    case 'X': color = RED; break;
-                }
-            }
-
-            for (int j = 0; j < 7; j++) {
-                symbolLines[j].push_back(color + lines[j] + RESET);
+    // Membaca satu baris dengan gema manual (terminal tetap di raw mode)
+    string readLine(size_t maxLength) {
+        string line;
+        while (true) {
+            char ch = readKey();
+            if (ch == '\0') break;
+            if (ch == '\r' || ch == '\n') {
+                if (line.empty()) continue;
+                break;
             }
-        }
-
-        if (isInput) {
-            int remaining = digits - number.length();
-            for (int r = 0; r < remaining; r++) {
-                for (int j = 0; j < 7; j++) {
-                    symbolLines[j].push_back(CYAN + string(" _____ ") + RESET);
+            if (ch == 8 || ch == 127) {
+                if (!line.empty()) {
+                    line.pop_back();
+                    cout << "\b \b";
                 }
+            } else if (isgraph(static_cast<unsigned char>(ch)) && line.size() < maxLength) {
+                line += ch;
+                cout << ch;
             }
         }
+        cout << "\n";
+        return line;
+    }
 
-        for (int i = 0; i < 7; i++) {
-            string fullLine;
-            for (const auto& part : symbolLines[i]) fullLine += part + " ";
-            printInBorder(fullLine, true);
+    // Input integer yang aman
+    int readInteger(const string& prompt, int min, int max) {
+        while (true) {
+            cout << prompt;
+            string line = readLine(9);
+            if (line.empty() && terminal.isClosed()) return min;
+            bool numeric = !line.empty() && all_of(line.begin(), line.end(), [](char c) { return isdigit(static_cast<unsigned char>(c)); });
+            int value = numeric ? atoi(line.c_str()) : min - 1;
+            if (value >= min && value <= max) return value;
+            cout << "Input tidak valid. Masukkan angka antara " << min << " dan " << max << ".\n";
         }
     }
 
-    // Menampilkan petunjuk panah di sebelah tebakan
-    void displayArrowHint(const string& guess, const string& feedback) {
-        if (guess == target) return;
-
-        string arrowArt = (guess < target) ? arrowSymbols.at("UP") : arrowSymbols.at("DOWN");
-        stringstream arrow_ss(arrowArt);
-        vector<string> arrowLines;
-        string arrowLine;
-        while(getline(arrow_ss, arrowLine, '\n')) arrowLines.push_back(arrowLine);
-
-        vector<vector<string>> guessLines(7);
-        for (size_t i = 0; i < guess.size(); i++) {
-            stringstream digit_ss(digitSymbols.at(guess[i]));
-            vector<string> lines;
-            string line;
-            while(getline(digit_ss, line, '\n')) lines.push_back(line);
-
-            string color = RESET;
-            if (i < feedback.size()) {
-                switch (feedback[i]) {
-                    case 'G': color = GREEN; break;
-                    case 'Y': color = YELLOW; break;
-                    case 'X': color = RED; break;
-                }
-            }
-
-            for (int j = 0; j < 7; j++) {
-                guessLines[j].push_back(color + lines[j] + RESET);
+    // KONSTRUKTOR
+    SymbolicNumbler(int initial_digits = 4, int initial_attempts = 6) : core(initial_digits, initial_attempts) {
+        const char* recordPath = getenv("SYMBOLIC_RECORD");
+        if (!recordPath) recorder = make_unique<RecordingWriter>();
+        else if (strcmp(recordPath, "0") != 0) recorder = make_unique<RecordingWriter>(recordPath);
+        const char* bookPath = getenv("SYMBOLIC_BOOK");
+        book.open(bookPath ? bookPath : "symbolic_book.bin");
+        // SYMBOLIC_DIFFICULTY=FILE mengganti tabel; tanpa tabel skor tidak dikali
+        const char* difficultyPath = getenv("SYMBOLIC_DIFFICULTY");
+        loadDifficultyTable(difficultyPath ? difficultyPath : "symbolic_difficulty.txt");
+        const char* allocPath = getenv("SYMBOLIC_ALLOC_REPORT");
+        if (allocPath && allocHooksLinked()) allocReportPath = allocPath;
+        if (const char* broadcastPath = getenv("SYMBOLIC_BROADCAST")) {
+            string path = strcmp(broadcastPath, "1") == 0 ? defaultBroadcastPath() : broadcastPath;
+            if (broadcast.open(path)) {
+                screen.setBroadcast(&broadcast);
+                presenter.setBroadcast(&broadcast);
+            } else {
+                cerr << "Siaran tidak bisa dibuka: " << path << "\n";
             }
         }
-        
-        for (int j = 0; j < 7; j++) {
-            guessLines[j].push_back("  " + arrowLines[j]);
-        }
-        
-        for (int j = 0; j < 7; j++) {
-            string fullLine;
-            for (const auto& part : guessLines[j]) fullLine += part + " ";
-            printInBorder(fullLine, true);
-        }
+        terminal.enter();
+        startNewGame(initial_digits, initial_attempts);
+        loadLeaderboard();
     }
 
-    // Menampilkan papan permainan utama
-    void displayBoard() {
-        clearScreen();
-        printBorder(true);
-        printInBorder("S Y M B O L I C   N U M B L E R", true);
-        printInBorder("Tebak angka " + to_string(digits) + "-digit!", true);
-        printBorder();
-        printInBorder(string("Legenda: ") + GREEN + "Hijau" + RESET + "=Benar, " + YELLOW + "Kuning" + RESET + "=Posisi Salah, " + RED + "Merah" + RESET + "=Salah", true);
-        printBorder();
-
-        if (!guesses.empty()) {
-            printInBorder("Tebakan sebelumnya:", false);
-            printEmptyBorderLine();
-            for (size_t i = 0; i < guesses.size(); i++) {
-                printInBorder("Percobaan " + to_string(i + 1) + ":", false);
-                if (guesses[i] != target) {
-                    displayArrowHint(guesses[i], results[i]);
-                } else {
-                    displaySymbolicNumber(guesses[i], results[i]);
-                }
-                if (i < guesses.size() - 1) printEmptyBorderLine();
-            }
-            printBorder();
-        }
+    // Memulai atau mereset permainan dengan pengaturan baru
+    void startNewGame(int newDigits, int newAttempts, bool timedMode = false, const string& fixedTarget = "") {
+        if (fixedTarget.empty()) core.startNewGame(newDigits, newAttempts, rng);
+        else core.startNewGame(newDigits, newAttempts, fixedTarget);
+        hintText.clear();
+        pendingKeys.clear();
+        candidates.reset(newDigits);
+        timed = timedMode;
+        columns = getTerminalColumns();
+        rows = getTerminalRows();
+        board.configure(newDigits, columns);
+    }
 
-        int remaining = maxAttempts - currentAttempt;
-        printInBorder("Sisa percobaan: " + to_string(remaining), true);
-        printBorder();
+    // Memulai layar baru setelah output lain (menu, prompt) mengubah terminal
+    void beginScreen() {
+        presenter.waitIdle(); // Frame papan yang tertunda selesai dulu agar output tidak bercampur
+        presenter.invalidate();
+        rows = getTerminalRows();
+        screen.setHeight(static_cast<size_t>(rows));
+        screen.invalidate();
+        screen.beginFrame();
     }
 
-    // LOGIKA PERMAINAN
-    string evaluateGuess(const string& guess) {
-        string result(guess.length(), ' ');
-        vector<bool> targetUsed(target.length(), false);
-        vector<bool> guessUsed(guess.length(), false);
-
-        for (size_t i = 0; i < guess.length(); i++) {
-            if (guess[i] == target[i]) {
-                result[i] = 'G';
-                targetUsed[i] = true;
-                guessUsed[i] = true;
-            }
-        }
-        for (size_t i = 0; i < guess.length(); i++) {
-            if (!guessUsed[i]) {
-                for (size_t j = 0; j < target.length(); j++) {
-                    if (!targetUsed[j] && guess[i] == target[j]) {
-                        result[i] = 'Y';
-                        targetUsed[j] = true;
-                        break;
-                    }
-                }
-            }
-        }
-        for (size_t i = 0; i < result.length(); i++) {
-            if (result[i] == ' ') result[i] = 'X';
-        }
-        return result;
+    // Menampilkan menu utama (prompt pilihan ditulis oleh pemanggil)
+    void showMenu() {
+        SYMBOLIC_ALLOC_SCOPE(AllocPhase::RENDER);
+        beginScreen();
+        board.displayMenu();
+        screen.present();
     }
-    
+
+    // Latensi tombol sampai frame: semua tombol dalam satu frame selesai bersamaan
+    void recordShownKeys() {
+        Clock::time_point shown = Clock::now();
+        for (Clock::time_point at : pendingKeys) traceRecord(TracePhase::FRAME, at, shown);
+        pendingKeys.clear();
+    }
+
     // Mendapatkan input tebakan dari pemain
     string getGuessInput() {
+        SYMBOLIC_ALLOC_SCOPE(AllocPhase::INPUT);
+        const size_t digits = static_cast<size_t>(core.getDigits());
         string input = "";
         while (true) {
-            displayBoard();
-            printInBorder("Tebakan saat ini:", false);
-            displaySymbolicNumber(input, "", true);
-            printBorder();
-            printInBorder("Ketik 0-9, Backspace untuk hapus, Enter untuk kirim, Q untuk keluar", true);
-            printBorder(false, true);
-
-            char ch = getChar();
-            if (ch == '\r' || ch == '\n') {
-                if (input.length() == static_cast<size_t>(digits)) break;
-                else {
-                    clearScreen();
-                    printBorder(true);
-                    printInBorder(string(RED) + "Butuh tepat " + to_string(digits) + " digit!" + RESET, true);
-                    printBorder(false, true);
+            // Snapshot diserahkan ke thread render; tidak pernah menunggu terminal
+            Clock::time_point now = Clock::now();
+            for (Clock::time_point at : pendingKeys) presenter.keyPressed(at);
+            pendingKeys.clear();
+            BoardSnapshot& snapshot = presenter.next();
+            snapshot.core = core;
+            snapshot.input = input;
+            snapshot.hintText = hintText;
+            snapshot.elapsedMs = timed ? elapsedMs(now) : -1;
+            snapshot.remaining = candidates.isActive() ? static_cast<int64_t>(candidates.count()) : -1;
+            snapshot.columns = columns;
+            snapshot.rows = rows;
+            snapshot.hintKey = hintAvailable();
+            snapshot.candidatesKey = candidates.isActive();
+            snapshot.showLatency = showLatency;
+            presenter.publish();
+
+            // Jam speedrun digambar ulang di setiap batas 100 ms
+            if (timed) terminal.setTimer(CLOCK_TIMER, chrono::milliseconds(CLOCK_TICK_MS - elapsedMs(now) % CLOCK_TICK_MS));
+
+            int timerId;
+            TerminalSession::Wake wake = terminal.wait(timerId);
+            if (wake == TerminalSession::Wake::CLOSED) return "QUIT";
+            if (wake == TerminalSession::Wake::TIMER) continue;
+
+            // Semua tombol yang sudah tiba (misalnya hasil tempel) masuk ke satu frame
+            TerminalSession::Key key;
+            while (terminal.popKey(key)) {
+                char ch = key.ch;
+                allocs.keystroke();
+                if (traceEnabled()) {
+                    traceRecord(TracePhase::INPUT, key.at, Clock::now());
+                    pendingKeys.push_back(key.at);
+                }
+                if (ch == '\r' || ch == '\n') {
+                    if (input.length() == digits) {
+                        // Tombol sesudah Enter tetap di antrean untuk tebakan berikutnya
+                        terminal.cancelTimer(CLOCK_TIMER);
+                        submittedAt = key.at;
+                        hintText.clear();
+                        return input;
+                    }
+                    {
+                        SYMBOLIC_ALLOC_SCOPE(AllocPhase::RENDER);
+                        beginScreen();
+                        board.displayNotice("Butuh tepat " + to_string(digits) + " digit!");
+                        screen.present();
+                    }
+                    recordShownKeys();
                     pauseForInput();
+                    break;
+                } else if (ch == 8 || ch == 127) {
+                    if (!input.empty()) input.pop_back();
+                } else if (isdigit(static_cast<unsigned char>(ch))) {
+                    if (input.length() < digits) input += ch;
+                } else if (tolower(ch) == 'h' && hintAvailable()) {
+                    showHint();
+                } else if (tolower(ch) == 'k' && candidates.isActive()) {
+                    hintText = describeCandidates(candidates, rng, CANDIDATES_SHOWN);
+                } else if (tolower(ch) == 't') {
+                    showLatency = !showLatency;
+                    if (showLatency) traceEnable(true); // Mulai mencatat saat pertama kali diminta
+                } else if (tolower(ch) == 'q') {
+                    terminal.cancelTimer(CLOCK_TIMER);
+                    return "QUIT";
                 }
-            } else if (ch == 8 || ch == 127) {
-                if (!input.empty()) input.pop_back();
-            } else if (isdigit(ch)) {
-                if (input.length() < static_cast<size_t>(digits)) input += ch;
-            } else if (tolower(ch) == 'q') {
-                return "QUIT";
             }
         }
-        return input;
+    }
+
+    // Meminta tebakan terbaik dari pencari dalam batas waktu tetap
+    // Pencari dan buku hanya sampai CANDIDATE_MAX_DIGITS digit
+    bool hintAvailable() const { return core.getDigits() <= CANDIDATE_MAX_DIGITS; }
+
+    void showHint() {
+        SYMBOLIC_ALLOC_SCOPE(AllocPhase::EVALUATE);
+        SolverOptions options;
+        options.budgetMs = HINT_BUDGET_MS;
+        SolverResult result;
+        if (!solveNextGuess(book, core.getDigits(), historyOf(core), options, result)) {
+            hintText = "Petunjuk tidak tersedia.";
+            return;
+        }
+        hintText = "Petunjuk: " + result.guess + " (" + to_string(result.candidates) + " kemungkinan tersisa)";
     }
     
     // Menampilkan statistik akhir permainan
-    void displayStats(bool won) {
-        clearScreen();
-        printBorder(true);
-        if (won) {
-            printInBorder("*** SELAMAT! ***", true);
-            printInBorder("Anda menebaknya dalam " + to_string(currentAttempt) + " percobaan!", true);
-        } else {
-            printInBorder("*** PERMAINAN BERAKHIR! ***", true);
-            printInBorder("Angkanya adalah:", true);
-        }
-        printBorder();
-        displaySymbolicNumber(target);
-        printBorder(false, true);
+    void displayStats(bool won, int64_t elapsed = -1) {
+        SYMBOLIC_ALLOC_SCOPE(AllocPhase::RENDER);
+        beginScreen();
+        board.displayStats(core, won, elapsed);
+        screen.present();
+        recordShownKeys();
     }
 
     // Loop utama permainan
     void playGame() {
-        while (currentAttempt < maxAttempts) {
+        presenter.invalidate();
+        startedAt = Clock::now();
+        gameStartedAt = recordingNowMs();
+        guessMs.clear();
+        allocs.beginGame();
+        while (!core.isOver()) {
             string guess = getGuessInput();
-            if (guess == "QUIT") return;
-
-            guesses.push_back(guess);
-            results.push_back(evaluateGuess(guess));
-            currentAttempt++;
+            if (guess == "QUIT") {
+                recordGame(0, "");
+                presenter.waitIdle(); // Prompt berikutnya ditulis langsung lewat cout
+                return;
+            }
 
-            if (guess == target) {
-                displayStats(true);
-                int score = calculateScore();
-                addScoreToLeaderboard(score);
+            core.submitGuess(guess);
+            candidates.sync(core);
+            guessMs.push_back(static_cast<uint32_t>(elapsedMs(submittedAt)));
+
+            if (core.isWon()) {
+                int64_t elapsed = timed ? elapsedMs(submittedAt) : -1;
+                displayStats(true, elapsed);
+                int score = timed ? calculateTimedScore(core.getMaxAttempts(), core.getCurrentAttempt(), core.getDigits(), elapsed)
+                                  : core.calculateScore();
+                string name = addScoreToLeaderboard(score, timed ? static_cast<uint32_t>(elapsed) : 0);
+                recordGame(score, name);
                 return;
             }
         }
-        displayStats(false);
+        displayStats(false, timed ? elapsedMs(submittedAt) : -1);
+        recordGame(0, "");
+    }
+
+    // Menyerahkan permainan ke thread penulis rekaman; disk tidak pernah ditunggu di sini
+    void recordGame(int score, const string& name) {
+        reportAllocations();
+        if (!recorder) return;
+        GameRecord record;
+        fillGameRecord(record, core);
+        record.timed = timed;
+        record.startedAt = gameStartedAt;
+        record.elapsedMs = guessMs.empty() ? 0 : guessMs.back();
+        record.score = score;
+        record.playerName = name;
+        record.guessMs = guessMs;
+        recorder->record(std::move(record));
     }
     
+    // Dipanggil sekali di akhir setiap permainan (menang, kalah atau keluar)
+    void reportAllocations() {
+        AllocGameReport report = allocs.endGame();
+        gamesPlayed++;
+        if (allocReportPath.empty()) return;
+        ofstream file(allocReportPath, ios::app);
+        string outcome = core.isWon() ? "menang" : core.isOver() ? "kalah" : "keluar";
+        file << report.format("Permainan " + to_string(gamesPlayed) + " (" + to_string(core.getDigits()) + " digit, " +
+                              to_string(core.getCurrentAttempt()) + "/" + to_string(core.getMaxAttempts()) +
+                              " percobaan, " + outcome + ")");
+    }
+
     // Menampilkan instruksi
-    void showInstructions() {
-        clearScreen();
-        printBorder(true);
-        printInBorder("INSTRUKSI SYMBOLIC NUMBLER", true);
-        printBorder();
-        printInBorder("* Tebak angka rahasia " + to_string(digits) + "-digit.", false);
-        printInBorder("* Anda memiliki " + to_string(maxAttempts) + " percobaan.", false);
-        printInBorder(string("* ") + GREEN + "HIJAU" + RESET + ": Digit & posisi benar.", false);
-        printInBorder(string("* ") + YELLOW + "KUNING" + RESET + ": Digit benar, posisi salah.", false);
-        printInBorder(string("* ") + RED + "MERAH" + RESET + ": Digit salah.", false);
-        printInBorder("* Panah akan menunjukkan angka rahasia lebih tinggi atau rendah.", false);
-        printBorder(false, true);
+    void showInstructions(const string& notice = "") {
+        {
+            SYMBOLIC_ALLOC_SCOPE(AllocPhase::RENDER);
+            beginScreen();
+            if (!notice.empty()) screen.addLine(notice);
+            board.displayInstructions(core, hintAvailable(), timed);
+            screen.present();
+        }
         pauseForInput();
     }
 
+    const ScreenBuffer& getScreen() const { return screen; }
+    const BoardPresenter& getPresenter() const { return presenter; }
+    const BroadcastPublisher& getBroadcast() const { return broadcast; }
+
     // FUNGSI PAPAN PERINGKAT
     void loadLeaderboard() {
-        ifstream file(leaderboardFilename);
-        if (!file.is_open()) return;
-        leaderboard.clear();
-        ScoreEntry entry;
-        while (file >> entry.playerName >> entry.score >> entry.digits >> entry.attempts) {
-            leaderboard.push_back(entry);
-        }
-        file.close();
+        leaderboard.load();
     }
 
-    void saveLeaderboard() {
-        sort(leaderboard.begin(), leaderboard.end(), [](const ScoreEntry& a, const ScoreEntry& b) {
-            return a.score > b.score;
-        });
-        ofstream file(leaderboardFilename);
-        for (const auto& entry : leaderboard) {
-            file << entry.playerName << " " << entry.score << " " << entry.digits << " " << entry.attempts << "\n";
-        }
-        file.close();
-    }
-
-    void addScoreToLeaderboard(int score) {
+    // Mengembalikan nama yang dimasukkan pemain
+    string addScoreToLeaderboard(int score, uint32_t elapsed) {
         cout << "\nSkor Anda: " << score << ". Masukkan nama (tanpa spasi): ";
-        string name;
-        cin >> name;
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-
-        leaderboard.push_back({name.substr(0, 15), score, digits, currentAttempt});
-        sort(leaderboard.begin(), leaderboard.end(), [](const ScoreEntry& a, const ScoreEntry& b) {
-            return a.score > b.score;
-        });
-        if (leaderboard.size() > 10) leaderboard.resize(10);
-        
-        saveLeaderboard();
-        displayLeaderboard();
+        string name = readLine(15);
+        if (name.empty()) name = "anonim"; // Input ditutup sebelum nama diketik
+
+        // Semua skor disimpan; tampilan hanya memuat sepuluh teratas
+        leaderboard.add({name, score, core.getDigits(), core.getCurrentAttempt(), 0, elapsed});
+        displayLeaderboard({core.getDigits(), 0}, {name, score, core.getDigits(), core.getCurrentAttempt()});
+        return name;
     }
 
-    void displayLeaderboard() {
-        clearScreen();
-        printBorder(true);
-        printInBorder("PAPAN PERINGKAT", true);
-        printBorder();
-        
-        if (leaderboard.empty()) {
-            printInBorder("Papan peringkat masih kosong. Jadilah yang pertama!", true);
-        } else {
-            cout << CYAN << "| " << RESET << left
-                 << setw(5) << "No."
-                 << setw(20) << "Nama"
-                 << setw(15) << "Skor"
-                 << setw(15) << "Digit"
-                 << setw(15) << "Percobaan" << string(BORDER_WIDTH - 74, ' ') << CYAN << "|" << RESET << endl;
-            printBorder();
-            int rank = 1;
-            for (const auto& entry : leaderboard) {
-                cout << CYAN << "| " << RESET << left
-                     << setw(5) << to_string(rank) + "."
-                     << setw(20) << entry.playerName
-                     << setw(15) << entry.score
-                     << setw(15) << entry.digits
-                     << setw(15) << entry.attempts << string(BORDER_WIDTH - 74, ' ') << CYAN << "|" << RESET << endl;
-                rank++;
+    // Tombol digit berpindah ke peringkat per jumlah digit, 0 ke seluruh papan
+    void displayLeaderboard(RankingKey key = {}, const RankingQuery& query = {}) {
+        leaderboard.refresh(); // Skor dari proses game lain di kios yang sama
+        while (true) {
+            LeaderboardView view = leaderboardView(leaderboard, key, LEADERBOARD_ROWS, query);
+            {
+                SYMBOLIC_ALLOC_SCOPE(AllocPhase::RENDER);
+                beginScreen();
+                board.displayLeaderboard(view);
+                screen.present();
             }
+            cout << "\nTekan 1-9 untuk peringkat per digit, 0 untuk semua, tombol lain untuk melanjutkan...";
+            char choice = readKey();
+            if (!isdigit(static_cast<unsigned char>(choice))) return;
+            key = {choice - '0', 0};
         }
-        
-        printBorder(false, true);
-        pauseForInput();
     }
 };
 
-// Fungsi untuk mendapatkan input integer yang aman
-int getIntegerInput(const string& prompt, int min, int max) {
-    int value;
-    while (true) {
-        cout << prompt;
-        cin >> value;
-        if (cin.good() && value >= min && value <= max) {
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            return value;
-        }
-        cin.clear();
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        cout << "Input tidak valid. Masukkan angka antara " << min << " dan " << max << ".\n";
-    }
-}
-
 /*
  * FUNGSI MAIN - TITIK MASUK PROGRAM
  */
 int main() {
+    traceStartFromEnv(); // SYMBOLIC_TRACE=FILE: catat sejak awal dan tulis trace Chrome saat keluar
     SymbolicNumbler game; // Buat satu objek game di awal
 
     while (true) {
-        SymbolicNumbler::clearScreen();
-        cout << "\n";
-        cout << "+============================================================+\n";
-        cout << "|           Selamat Datang di SYMBOLIC NUMBLER!              |\n";
-        cout << "+============================================================+\n\n";
-
-        cout << "Pilih Menu:\n";
-        cout << "1. Mudah (3 digit, 6 percobaan)\n";
-        cout << "2. Sedang (4 digit, 6 percobaan)\n";
-        cout << "3. Sulit (5 digit, 6 percobaan)\n";
-        cout << "4. Ahli (6 digit, 8 percobaan)\n";
-        cout << "5. Kustom\n";
-        cout << "6. Papan Peringkat\n";
-        cout << "7. Keluar\n";
-        cout << "Pilihan (1-7): ";
-
-        char choice = SymbolicNumbler::getChar();
+        game.showMenu();
+        cout << "Pilihan (1-9, D): ";
+
+        char choice = game.readKey();
+        if (choice == '\0') break; // Input ditutup
         cout << choice << endl;
 
-        if (choice == '7' || tolower(choice) == 'q') break;
+        if (choice == '9' || tolower(choice) == 'q') break;
         if (choice == '6') {
             game.displayLeaderboard();
             continue;
         }
 
         int digits, attempts;
+        bool timed = false;
+        string fixedTarget, notice;
         switch (choice) {
             case '1': digits = 3; attempts = 6; break;
             case '2': digits = 4; attempts = 6; break;
             case '3': digits = 5; attempts = 6; break;
             case '4': digits = 6; attempts = 8; break;
             case '5':
-                digits = getIntegerInput("Masukkan jumlah digit (3-6): ", 3, 6);
-                attempts = getIntegerInput("Masukkan jumlah percobaan (4-10): ", 4, 10);
+                digits = game.readInteger("Masukkan jumlah digit (3-6): ", CUSTOM_MIN_DIGITS, CUSTOM_MAX_DIGITS);
+                attempts = game.readInteger("Masukkan jumlah percobaan (4-10): ", 4, 10);
+                break;
+            case '7': digits = 4; attempts = 6; timed = true; break;
+            case 'd':
+            case 'D': {
+                DailyChallenge daily = todaysChallenge();
+                digits = daily.digits;
+                attempts = daily.maxAttempts;
+                fixedTarget = challengeTarget(daily);
+                notice = "Tantangan harian " + daily.date + ": target sama untuk semua pemain hari ini.";
+                break;
+            }
+            case '8':
+                digits = game.readInteger("Masukkan jumlah digit (" + to_string(MARATHON_MIN_DIGITS) + "-" +
+                                          to_string(MARATHON_MAX_DIGITS) + "): ", MARATHON_MIN_DIGITS, MARATHON_MAX_DIGITS);
+                attempts = game.readInteger("Masukkan jumlah percobaan (4-" + to_string(MARATHON_MAX_ATTEMPTS) + "): ", 4,
+                                            MARATHON_MAX_ATTEMPTS);
                 break;
             default:
                 cout << "Pilihan tidak valid. Memulai tingkat kesulitan sedang...\n";
                 digits = 4; attempts = 6;
                 // Jeda agar pengguna bisa membaca pesan
-                for(int i=0; i<100000000; ++i); // Delay sederhana
+                game.pause(chrono::milliseconds(1500));
         }
 
-        game.startNewGame(digits, attempts);
-        game.showInstructions();
+        game.startNewGame(digits, attempts, timed, fixedTarget);
+        game.showInstructions(notice);
         game.playGame();
 
         cout << "\nMain lagi? (y/n): ";
-        char playAgain = SymbolicNumbler::getChar();
+        char playAgain = game.readKey();
         cout << playAgain << endl;
         if (tolower(playAgain) != 'y') break;
     }
 
     cout << "\nTerima kasih telah bermain SYMBOLIC NUMBLER!\n";
+
+    // SYMBOLIC_FRAME_STATS=1 menampilkan ukuran rata-rata frame yang dikirim
+    if (getenv("SYMBOLIC_FRAME_STATS")) {
+        const ScreenBuffer& screen = game.getScreen();
+        uint64_t frames = screen.getFrameCount();
+        cout << "Frame: " << frames << ", total " << screen.getTotalBytes() << " byte, rata-rata "
+             << (frames ? screen.getTotalBytes() / frames : 0) << " byte/frame\n";
+        RenderCounters render = game.getPresenter().counters();
+        cout << "Papan (thread render): " << render.frames << " frame dari " << render.published << " snapshot, "
+             << render.bytes << " byte, " << render.coalesced << " frame digabung, " << render.dropped
+             << " snapshot dilewati\n";
+        const BroadcastPublisher& broadcast = game.getBroadcast();
+        if (broadcast.isOpen()) {
+            BroadcastStats stats = broadcast.stats();
+            cout << "Siaran " << broadcast.getPath() << ": " << stats.published << " frame, " << stats.truncated
+                 << " dipotong, " << stats.viewers.size() << " penonton\n";
+            for (const ViewerStats& viewer : stats.viewers) {
+                cout << "  Penonton " << viewer.pid << ": " << viewer.shown << " frame tampil, " << viewer.skipped
+                     << " dilewati, tertinggal " << stats.published - viewer.lastFrame << " frame, jeda rata-rata "
+                     << viewer.meanLagNs() / 1000 << " us, maks " << viewer.maxLagNs / 1000 << " us\n";
+            }
+        }
+    }
     return 0;
 }
@@ -0,0 +1,130 @@
+#include "symbolic_alloc.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+namespace {
+
+const char* const PHASE_NAMES[ALLOC_PHASE_COUNT] = {"lainnya", "input", "evaluasi", "render", "peringkat"};
+
+// Diinisialisasi konstan: operator new boleh dipanggil sebelum main
+atomic<uint64_t> allocations[ALLOC_PHASE_COUNT];
+atomic<uint64_t> allocatedBytes[ALLOC_PHASE_COUNT];
+atomic<bool> hooksLinked{false};
+thread_local AllocPhase currentPhase = AllocPhase::OTHER;
+
+} // namespace
+
+const char* allocPhaseName(AllocPhase phase) {
+    int index = static_cast<int>(phase);
+    return index < ALLOC_PHASE_COUNT ? PHASE_NAMES[index] : "?";
+}
+
+uint64_t AllocCounts::totalAllocations() const {
+    uint64_t total = 0;
+    for (uint64_t count : allocations) total += count;
+    return total;
+}
+
+uint64_t AllocCounts::totalBytes() const {
+    uint64_t total = 0;
+    for (uint64_t count : bytes) total += count;
+    return total;
+}
+
+AllocCounts AllocCounts::operator-(const AllocCounts& earlier) const {
+    AllocCounts result;
+    for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+        result.allocations[i] = allocations[i] - earlier.allocations[i];
+        result.bytes[i] = bytes[i] - earlier.bytes[i];
+    }
+    return result;
+}
+
+bool allocHooksLinked() {
+    return hooksLinked.load(memory_order_relaxed);
+}
+
+void allocMarkHooksLinked() {
+    hooksLinked.store(true, memory_order_relaxed);
+}
+
+void allocCount(size_t bytes) {
+    int index = static_cast<int>(currentPhase);
+    allocations[index].fetch_add(1, memory_order_relaxed);
+    allocatedBytes[index].fetch_add(bytes, memory_order_relaxed);
+}
+
+AllocCounts allocSnapshot() {
+    AllocCounts result;
+    for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+        result.allocations[i] = allocations[i].load(memory_order_relaxed);
+        result.bytes[i] = allocatedBytes[i].load(memory_order_relaxed);
+    }
+    return result;
+}
+
+uint64_t allocTotal() {
+    uint64_t total = 0;
+    for (const auto& count : allocations) total += count.load(memory_order_relaxed);
+    return total;
+}
+
+AllocPhase allocSetPhase(AllocPhase phase) {
+    AllocPhase previous = currentPhase;
+    currentPhase = phase;
+    return previous;
+}
+
+/*
+ * LAPORAN
+ */
+void AllocTracker::beginGame() {
+    report = AllocGameReport();
+    gameStart = allocSnapshot();
+    keyOpen = false;
+}
+
+void AllocTracker::closeKey(const AllocCounts& now) {
+    AllocCounts delta = now - keyStart;
+    report.maxPerKey = max(report.maxPerKey, delta.totalAllocations());
+    for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+        report.maxPerKeyPhase[i] = max(report.maxPerKeyPhase[i], delta.allocations[i]);
+    }
+}
+
+void AllocTracker::keystroke() {
+    AllocCounts now = allocSnapshot();
+    if (keyOpen) closeKey(now);
+    keyStart = now;
+    keyOpen = true;
+    report.keystrokes++;
+}
+
+AllocGameReport AllocTracker::endGame() {
+    AllocCounts now = allocSnapshot();
+    if (keyOpen) closeKey(now);
+    keyOpen = false;
+    report.total = now - gameStart;
+    return report;
+}
+
+string AllocGameReport::format(const string& title) const {
+    ostringstream out;
+    uint64_t keys = max<uint64_t>(keystrokes, 1);
+    out << title << ": " << total.totalAllocations() << " alokasi, " << total.totalBytes() << " byte, " << keystrokes
+        << " tombol, maks " << maxPerKey << " alokasi per tombol\n";
+    out << "  " << left << setw(10) << "fase" << right << setw(10) << "alokasi" << setw(12) << "byte" << setw(12)
+        << "per tombol" << setw(12) << "maks/tombol" << "\n";
+    for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+        if (total.allocations[i] == 0 && maxPerKeyPhase[i] == 0) continue;
+        out << "  " << left << setw(10) << PHASE_NAMES[i] << right << setw(10) << total.allocations[i] << setw(12)
+            << total.bytes[i] << setw(12) << fixed << setprecision(1)
+            << static_cast<double>(total.allocations[i]) / keys << setw(12) << maxPerKeyPhase[i] << "\n";
+    }
+    return out.str();
+}
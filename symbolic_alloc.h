@@ -0,0 +1,111 @@
+/*
+ * SYMBOLIC NUMBLER - AKUNTANSI ALOKASI HEAP PER FASE
+ *
+ * operator new/delete global di symbolic_alloc_hooks.cpp menghitung setiap
+ * alokasi (jumlah dan byte) ke fase yang sedang aktif di thread pemanggil:
+ * input, evaluasi, render, papan peringkat, atau lainnya. Hook hanya
+ * ditautkan ke symbolic_bench dan, dengan -DSYMBOLIC_ALLOC_ACCOUNTING=ON,
+ * ke semua program; build biasa tidak membayar apa pun.
+ *
+ * AllocTracker memotong penghitung per tombol dan per permainan, dan
+ * symbolic_bench --check-allocations membandingkan skenario tetap dengan
+ * anggaran alokasi (bawaan atau --budget FILE) lalu gagal jika ada yang
+ * melebihi.
+ *
+ * Tanpa SYMBOLIC_ALLOC_ACCOUNTING saat kompilasi semua lingkup fase hilang
+ * dan alokasi hanya terhitung sebagai "lainnya".
+ */
+#ifndef SYMBOLIC_ALLOC_H
+#define SYMBOLIC_ALLOC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+enum class AllocPhase : uint8_t {
+    OTHER,       // Di luar lingkup mana pun
+    INPUT,       // Menangani tombol dan menyerahkan snapshot
+    EVALUATE,    // Tebakan dinilai, kandidat disaring, petunjuk dicari
+    RENDER,      // Menyusun dan menulis frame
+    LEADERBOARD, // Memuat, menambah, menyegarkan dan menampilkan peringkat
+    COUNT
+};
+
+constexpr int ALLOC_PHASE_COUNT = static_cast<int>(AllocPhase::COUNT);
+
+const char* allocPhaseName(AllocPhase phase);
+
+struct AllocCounts {
+    uint64_t allocations[ALLOC_PHASE_COUNT] = {};
+    uint64_t bytes[ALLOC_PHASE_COUNT] = {};
+
+    uint64_t totalAllocations() const;
+    uint64_t totalBytes() const;
+    AllocCounts operator-(const AllocCounts& earlier) const;
+};
+
+// true jika operator new penghitung ditautkan ke program ini
+bool allocHooksLinked();
+void allocMarkHooksLinked();
+
+// Dipanggil operator new; aman dari semua thread dan tidak pernah mengalokasikan
+void allocCount(size_t bytes);
+
+// Semua alokasi sejak program mulai, per fase
+AllocCounts allocSnapshot();
+uint64_t allocTotal();
+
+// Fase thread ini; mengembalikan fase sebelumnya
+AllocPhase allocSetPhase(AllocPhase phase);
+
+/*
+ * LAPORAN PER TOMBOL DAN PER PERMAINAN
+ * keystroke() dipanggil saat tombol tiba: selisih sejak tombol sebelumnya
+ * (termasuk frame yang digambar thread render untuknya) dicatat sebagai
+ * biaya tombol sebelumnya.
+ */
+struct AllocGameReport {
+    AllocCounts total;
+    uint64_t keystrokes = 0;
+    uint64_t maxPerKey = 0;                            // Alokasi terbanyak untuk satu tombol
+    uint64_t maxPerKeyPhase[ALLOC_PHASE_COUNT] = {};
+
+    // Beberapa baris teks untuk file laporan
+    std::string format(const std::string& title) const;
+};
+
+class AllocTracker {
+private:
+    AllocCounts gameStart;
+    AllocCounts keyStart;
+    bool keyOpen = false;
+    AllocGameReport report;
+
+    void closeKey(const AllocCounts& now);
+
+public:
+    void beginGame();
+    void keystroke();
+    AllocGameReport endGame();
+};
+
+#ifdef SYMBOLIC_ALLOC_ACCOUNTING
+class AllocPhaseScope {
+private:
+    AllocPhase previous;
+
+public:
+    explicit AllocPhaseScope(AllocPhase phase) : previous(allocSetPhase(phase)) {}
+    ~AllocPhaseScope() { allocSetPhase(previous); }
+    AllocPhaseScope(const AllocPhaseScope&) = delete;
+    AllocPhaseScope& operator=(const AllocPhaseScope&) = delete;
+};
+
+#define SYMBOLIC_ALLOC_CONCAT_(a, b) a##b
+#define SYMBOLIC_ALLOC_CONCAT(a, b) SYMBOLIC_ALLOC_CONCAT_(a, b)
+#define SYMBOLIC_ALLOC_SCOPE(phase) AllocPhaseScope SYMBOLIC_ALLOC_CONCAT(allocScope_, __LINE__)(phase)
+#else
+#define SYMBOLIC_ALLOC_SCOPE(phase) ((void)0)
+#endif
+
+#endif
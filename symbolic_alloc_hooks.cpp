@@ -0,0 +1,109 @@
+/*
+ * SYMBOLIC NUMBLER - OPERATOR NEW/DELETE PENGHITUNG
+ *
+ * Ditautkan langsung ke program (bukan lewat pustaka) agar menggantikan
+ * operator bawaan: selalu ke symbolic_bench, ke program lain hanya dengan
+ * -DSYMBOLIC_ALLOC_ACCOUNTING=ON. Setiap alokasi dihitung ke fase thread
+ * pemanggil lewat allocCount (symbolic_alloc.h).
+ */
+#include "symbolic_alloc.h"
+
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+
+// Menandai di awal program bahwa penghitung aktif
+const bool registered = (allocMarkHooksLinked(), true);
+
+void* countedAllocate(size_t size) {
+    allocCount(size);
+    return malloc(size ? size : 1);
+}
+
+void* countedAllocateAligned(size_t size, std::align_val_t alignment) {
+    allocCount(size);
+    size_t align = static_cast<size_t>(alignment);
+    if (align < sizeof(void*)) align = sizeof(void*);
+    // aligned_alloc butuh ukuran kelipatan perataan
+    size_t rounded = (size + align - 1) / align * align;
+#ifdef _WIN32
+    return _aligned_malloc(rounded ? rounded : align, align);
+#else
+    return aligned_alloc(align, rounded ? rounded : align);
+#endif
+}
+
+void freeAligned(void* block) {
+#ifdef _WIN32
+    _aligned_free(block);
+#else
+    free(block);
+#endif
+}
+
+} // namespace
+
+void* operator new(size_t size) {
+    if (void* block = countedAllocate(size)) return block;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    if (void* block = countedAllocate(size)) return block;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    if (void* block = countedAllocateAligned(size, alignment)) return block;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    if (void* block = countedAllocateAligned(size, alignment)) return block;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept {
+    free(block);
+}
+
+void operator delete[](void* block) noexcept {
+    free(block);
+}
+
+void operator delete(void* block, size_t) noexcept {
+    free(block);
+}
+
+void operator delete[](void* block, size_t) noexcept {
+    free(block);
+}
+
+void operator delete(void* block, std::align_val_t) noexcept {
+    freeAligned(block);
+}
+
+void operator delete[](void* block, std::align_val_t) noexcept {
+    freeAligned(block);
+}
+
+void operator delete(void* block, size_t, std::align_val_t) noexcept {
+    freeAligned(block);
+}
+
+void operator delete[](void* block, size_t, std::align_val_t) noexcept {
+    freeAligned(block);
+}
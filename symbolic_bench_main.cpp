@@ -0,0 +1,1201 @@
+/*
+ * SYMBOLIC NUMBLER - PROGRAM BENCHMARK
+ *
+ * Mengukur jalur panas game dan menulis hasilnya sebagai JSON agar bisa
+ * dibandingkan antar rilis:
+ *   evaluateGuess/...      satu pasangan per digit (string dan kode O(n))
+ *   evaluateFixed/...      satu pasangan terkemas lewat evaluator GameCore (spesialisasi 3-6 digit)
+ *   submitGuess/...        tebakan maraton terkemas 100-4096 digit
+ *   scoreGuessBatch/...    kernel massal, ns per kandidat
+ *   displayBoard/...       satu frame papan penuh ke sink kosong, dengan jumlah
+ *                          alokasi heap per frame
+ *   getVisualLength/...    baris panjang penuh kode warna
+ *   leaderboard/...        simpan, muat, tambah, bangun indeks peringkat dan kueri
+ *                          peringkat pada 10, 10k dan 1M skor
+ *   traceScope/...         biaya satu lingkup pelacakan, mati dan aktif
+ *   recording/...          menyerahkan satu permainan ke perekam, memindai rekaman
+ *   book/...               membuka buku pembukaan, petunjuk dari buku vs pencarian langsung
+ *   broadcast/...          menyiarkan satu frame papan ke memori bersama, membaca frame terbaru
+ *
+ * Contoh:
+ *   symbolic_bench --out bench.json
+ *   symbolic_bench --filter leaderboard --min-time 0.5
+ *   symbolic_bench --check-allocations   (gagal jika skenario melebihi anggaran alokasi)
+ *   symbolic_bench --check-allocations --budget anggaran.txt
+ *   symbolic_bench --verify              (gagal jika implementasi umpan balik berbeda dari algoritme asli)
+ *
+ * Alokasi dihitung oleh operator new di symbolic_alloc_hooks.cpp yang selalu
+ * ditautkan ke program ini.
+ */
+#include "symbolic_alloc.h"
+#include "symbolic_board.h"
+#include "symbolic_book.h"
+#include "symbolic_broadcast.h"
+#include "symbolic_candidates.h"
+#include "symbolic_core.h"
+#include "symbolic_engine.h"
+#include "symbolic_feedback.h"
+#include "symbolic_leaderboard.h"
+#include "symbolic_recording.h"
+#include "symbolic_render.h"
+#include "symbolic_screen.h"
+#include "symbolic_trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+using Clock = chrono::steady_clock;
+
+struct BenchOptions {
+    string outPath;       // Kosong = stdout
+    string filter;
+    double minSeconds = 0.2;
+    bool quick = false;   // Tanpa ukuran 1M
+    string dataDir;
+    bool checkAllocations = false;
+    bool verify = false;
+    string budgetPath;    // Kosong = anggaran bawaan
+};
+
+struct BenchResult {
+    string name;
+    uint64_t iterations = 0;
+    double seconds = 0;
+    vector<pair<string, double>> counters;
+
+    double nsPerOp() const { return iterations ? seconds * 1e9 / iterations : 0.0; }
+};
+
+// Mencegah kompiler membuang hasil yang tidak dipakai
+volatile uint64_t sink = 0;
+
+class BenchRunner {
+private:
+    const BenchOptions& options;
+    vector<BenchResult> results;
+
+public:
+    explicit BenchRunner(const BenchOptions& benchOptions) : options(benchOptions) {}
+
+    bool selected(const string& name) const {
+        return options.filter.empty() || name.find(options.filter) != string::npos;
+    }
+
+    // body(n) menjalankan n iterasi; n dinaikkan sampai waktu minimum tercapai
+    template <typename Body>
+    BenchResult& run(const string& name, Body&& body, uint64_t maxIterations = UINT64_MAX) {
+        uint64_t n = 1;
+        double seconds = 0;
+        while (true) {
+            Clock::time_point start = Clock::now();
+            body(n);
+            seconds = chrono::duration<double>(Clock::now() - start).count();
+            if (seconds >= options.minSeconds || n >= maxIterations) break;
+            double grow = seconds > 0 ? options.minSeconds * 1.2 / seconds : 100.0;
+            n = min(maxIterations, max(n + 1, static_cast<uint64_t>(n * min(grow, 100.0))));
+        }
+        return record(name, n, seconds);
+    }
+
+    BenchResult& record(const string& name, uint64_t iterations, double seconds) {
+        BenchResult result;
+        result.name = name;
+        result.iterations = iterations;
+        result.seconds = seconds;
+        results.push_back(result);
+        cerr << left << setw(40) << name << right << setw(14) << fixed << setprecision(1) << result.nsPerOp()
+             << " ns/op" << setw(12) << iterations << " iterasi\n";
+        return results.back();
+    }
+
+    const vector<BenchResult>& getResults() const { return results; }
+};
+
+void benchEvaluate(BenchRunner& runner) {
+    constexpr size_t PAIRS = 1024;
+    Rng gen(1);
+    for (int digits = 3; digits <= MAX_KERNEL_DIGITS; digits++) {
+        vector<string> targets, guesses;
+        vector<uint8_t> targetDigits, guessDigits;
+        for (size_t i = 0; i < PAIRS; i++) {
+            targets.push_back(generateTarget(digits, gen));
+            guesses.push_back(generateTarget(digits, gen));
+            for (char c : targets.back()) targetDigits.push_back(static_cast<uint8_t>(c - '0'));
+            for (char c : guesses.back()) guessDigits.push_back(static_cast<uint8_t>(c - '0'));
+        }
+
+        string name = "evaluateGuess/digits=" + to_string(digits);
+        if (runner.selected(name)) {
+            runner.run(name, [&](uint64_t n) {
+                uint64_t total = 0;
+                for (uint64_t i = 0; i < n; i++) total += evaluateGuess(targets[i % PAIRS], guesses[i % PAIRS])[0];
+                sink = sink + total;
+            });
+        }
+
+        // Jalur GameCore: spesialisasi per jumlah digit (3-6) atau evaluatePacked umum
+        name = "evaluateFixed/digits=" + to_string(digits);
+        if (runner.selected(name)) {
+            vector<PackedDigits> packedTargets, packedGuesses;
+            for (size_t i = 0; i < PAIRS; i++) {
+                packedTargets.push_back(PackedDigits::fromString(targets[i]));
+                packedGuesses.push_back(PackedDigits::fromString(guesses[i]));
+            }
+            GuessEvaluator evaluator = guessEvaluator(digits);
+            PackedDigits result;
+            BenchResult& bench = runner.run(name, [&](uint64_t n) {
+                uint64_t total = 0;
+                for (uint64_t i = 0; i < n; i++) {
+                    total += static_cast<uint64_t>(evaluator(packedTargets[i % PAIRS], packedGuesses[i % PAIRS], result));
+                    total += result.data()[0];
+                }
+                sink = sink + total;
+            });
+            bench.counters.push_back({"specialized", evaluator == evaluateGeneric ? 0.0 : 1.0});
+        }
+
+        name = "evaluateGuessCode/digits=" + to_string(digits);
+        if (runner.selected(name)) {
+            runner.run(name, [&](uint64_t n) {
+                uint64_t total = 0;
+                for (uint64_t i = 0; i < n; i++) {
+                    size_t k = (i % PAIRS) * digits;
+                    total += evaluateGuessCode(&targetDigits[k], &guessDigits[k], digits);
+                }
+                sink = sink + total;
+            });
+        }
+    }
+}
+
+// Mode maraton: simpan terkemas + evaluasi O(n) + panah untuk satu tebakan
+void benchMarathon(BenchRunner& runner) {
+    Rng gen(5);
+    for (int digits : {100, 1000, 4096}) {
+        string name = "submitGuess/digits=" + to_string(digits);
+        if (!runner.selected(name)) continue;
+
+        vector<string> guesses;
+        for (int i = 0; i < 16; i++) guesses.push_back(generateTarget(digits, gen));
+        GameCore core;
+        core.startNewGame(digits, MARATHON_MAX_ATTEMPTS, gen);
+        BenchResult& result = runner.run(name, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) {
+                if (core.isOver()) core.startNewGame(digits, MARATHON_MAX_ATTEMPTS, guesses[0]);
+                core.submitGuess(guesses[i % guesses.size()]);
+            }
+            sink = sink + core.getCurrentAttempt();
+        });
+        result.counters.push_back({"ns_per_digit", result.nsPerOp() / digits});
+    }
+}
+
+void benchBatch(BenchRunner& runner) {
+    for (int digits = 4; digits <= 6; digits++) {
+        string name = "scoreGuessBatch/digits=" + to_string(digits);
+        if (!runner.selected(name)) continue;
+
+        uint64_t space = 1;
+        for (int i = 0; i < digits; i++) space *= 10;
+        PackedCandidates candidates = PackedCandidates::fromRange(digits, 0, space);
+        vector<uint16_t> codes(candidates.size());
+        Rng gen(2);
+        string guess = generateTarget(digits, gen);
+        BenchResult& result = runner.run(name, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) scoreGuessBatch(guess, candidates, 0, candidates.size(), codes.data());
+            sink = sink + codes[0];
+        });
+        // Per kandidat lebih berguna daripada per panggilan
+        result.counters.push_back({"ns_per_candidate", result.nsPerOp() / candidates.size()});
+    }
+}
+
+// Pelacak kandidat: tebakan pertama menyaring seluruh ruang (kasus terberat per frame),
+// lalu satu permainan penuh dengan tebakan yang konsisten
+void benchCandidates(BenchRunner& runner) {
+    for (int digits = 5; digits <= CANDIDATE_MAX_DIGITS; digits++) {
+        string name = "candidates/first/digits=" + to_string(digits);
+        if (!runner.selected(name)) continue;
+
+        Rng gen(8);
+        vector<GameCore> games(16);
+        for (auto& game : games) {
+            game.startNewGame(digits, 8, gen);
+            game.submitGuess(generateTarget(digits, gen));
+        }
+        CandidateTracker tracker;
+        size_t remaining = 0;
+        BenchResult& result = runner.run(name, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) {
+                tracker.reset(digits);
+                tracker.sync(games[i % games.size()]);
+                remaining += tracker.count();
+            }
+            sink = sink + remaining;
+        });
+        result.counters.push_back({"ns_per_candidate", result.nsPerOp() / static_cast<double>(powerOfTen(digits))});
+    }
+
+    if (runner.selected("candidates/game/digits=6")) {
+        Rng gen(9);
+        CandidateTracker tracker;
+        GameCore core;
+        runner.run("candidates/game/digits=6", [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) {
+                core.startNewGame(6, 8, gen);
+                tracker.reset(6);
+                core.submitGuess(generateTarget(6, gen));
+                while (!core.isOver()) {
+                    tracker.sync(core);
+                    core.submitGuess(tracker.sample(gen));
+                }
+            }
+            sink = sink + core.getCurrentAttempt();
+        });
+    }
+}
+
+// Pembuatan target: satu per satu lewat Rng, dan massal ke bentuk terkemas
+void benchRandom(BenchRunner& runner) {
+    if (runner.selected("generateTarget/digits=5")) {
+        Rng gen(7);
+        runner.run("generateTarget/digits=5", [&](uint64_t n) {
+            uint64_t total = 0;
+            for (uint64_t i = 0; i < n; i++) total += static_cast<uint64_t>(generateTarget(5, gen)[0]);
+            sink = sink + total;
+        });
+    }
+
+    constexpr size_t COUNT = 1000000;
+    for (unsigned threads : {1u, 0u}) {
+        string name = "generateTargets/count=1000000/threads=" + (threads ? to_string(threads) : string("all"));
+        if (!runner.selected(name)) continue;
+        PackedCandidates targets;
+        BenchResult& result = runner.run(name, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) generateTargets(i, 5, COUNT, targets, threads);
+            sink = sink + targets.size();
+        });
+        result.counters.push_back({"ns_per_target", result.nsPerOp() / COUNT});
+    }
+}
+
+// Thread render di depan terminal lambat (2 ms per frame): biaya di sisi input harus tetap
+// sebesar menyalin snapshot, dan status di antara frame digabung
+void benchRender(BenchRunner& runner) {
+    const string name = "render/publish/slowTerminal";
+    if (!runner.selected(name)) return;
+
+    Rng gen(10);
+    GameCore core;
+    core.startNewGame(4, 6, gen);
+    for (int i = 0; i < 4; i++) core.submitGuess(generateTarget(4, gen));
+    BoardPresenter presenter([](const string&) { this_thread::sleep_for(chrono::milliseconds(2)); });
+
+    BenchResult& result = runner.run(name, [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+            BoardSnapshot& snapshot = presenter.next();
+            snapshot.core = core;
+            snapshot.input.assign(1 + i % 4, static_cast<char>('0' + i % 10));
+            snapshot.hintText.clear();
+            snapshot.elapsedMs = static_cast<int64_t>(i);
+            snapshot.remaining = -1;
+            snapshot.columns = 80;
+            snapshot.hintKey = snapshot.candidatesKey = snapshot.showLatency = false;
+            presenter.publish();
+        }
+    });
+    presenter.waitIdle();
+    RenderCounters stats = presenter.counters();
+    result.counters.push_back({"frames", static_cast<double>(stats.frames)});
+    result.counters.push_back({"coalesced", static_cast<double>(stats.coalesced)});
+    result.counters.push_back({"dropped", static_cast<double>(stats.dropped)});
+}
+
+// Papan dengan semua percobaan kecuali satu sudah terisi: frame terbesar saat bermain
+void benchBoard(BenchRunner& runner) {
+    struct BoardCase {
+        int digits, attempts;
+        bool fullRedraw;
+    };
+    const BoardCase cases[] = {{4, 6, false}, {6, 8, false}, {4, 6, true}, {6, 8, true}, {1000, 10, false}};
+    for (const auto& boardCase : cases) {
+        string name = "displayBoard/digits=" + to_string(boardCase.digits) +
+                      (boardCase.fullRedraw ? "/full" : "/diff");
+        if (!runner.selected(name)) continue;
+
+        Rng gen(3);
+        GameCore core;
+        core.startNewGame(boardCase.digits, boardCase.attempts, gen);
+        while (core.getRemainingAttempts() > 1) {
+            string guess = generateTarget(boardCase.digits, gen);
+            if (guess == core.getTarget()) continue;
+            core.submitGuess(guess);
+        }
+
+        ScreenBuffer screen;
+        BoardRenderer board(screen);
+        board.configure(boardCase.digits, 0);
+        string typing = generateTarget(boardCase.digits, gen), input;
+        input.reserve(typing.size());
+        uint64_t bytes = 0;
+        double allocationsPerFrame = 0;
+        BenchResult& result = runner.run(name, [&](uint64_t n) {
+            uint64_t allocationsBefore = allocTotal();
+            for (uint64_t i = 0; i < n; i++) {
+                // Setiap frame berbeda dari sebelumnya, seperti saat mengetik
+                if (boardCase.fullRedraw) screen.invalidate();
+                screen.beginFrame();
+                board.displayBoard(core);
+                input.assign(typing, 0, i % (boardCase.digits + 1));
+                board.displayGuessInput(input, "", true);
+                bytes += screen.composeFrame().size();
+            }
+            sink = sink + bytes;
+            // Putaran terakhir (yang terpanjang) yang dilaporkan
+            allocationsPerFrame = static_cast<double>(allocTotal() - allocationsBefore) / n;
+        });
+        double frames = static_cast<double>(max<uint64_t>(1, screen.getFrameCount()));
+        result.counters.push_back({"bytes_per_frame", static_cast<double>(bytes) / frames});
+        result.counters.push_back({"allocs_per_frame", allocationsPerFrame});
+    }
+}
+
+void benchVisualLength(BenchRunner& runner) {
+    for (int visible : {80, 1000, 10000}) {
+        string name = "getVisualLength/chars=" + to_string(visible);
+        if (!runner.selected(name)) continue;
+
+        // Warna berganti setiap empat karakter, seperti baris glif berwarna
+        const char* colors[] = {BoardRenderer::GREEN, BoardRenderer::YELLOW, BoardRenderer::RED, BoardRenderer::CYAN};
+        string line;
+        for (int i = 0; i < visible; i++) {
+            if (i % 4 == 0) line += colors[(i / 4) % 4];
+            line += static_cast<char>('#' + i % 8);
+        }
+        line += BoardRenderer::RESET;
+
+        BenchResult& result = runner.run(name, [&](uint64_t n) {
+            uint64_t total = 0;
+            for (uint64_t i = 0; i < n; i++) total += static_cast<uint64_t>(getVisualLength(line));
+            sink = sink + total;
+        });
+        result.counters.push_back({"bytes", static_cast<double>(line.size())});
+        result.counters.push_back({"bytes_per_second", line.size() / (result.nsPerOp() * 1e-9)});
+    }
+}
+
+// Lingkup kosong: yang terukur hanya biaya pelacakan itu sendiri
+void benchTraceScope(BenchRunner& runner) {
+    for (bool enabled : {false, true}) {
+        string name = string("traceScope/") + (enabled ? "enabled" : "disabled");
+        if (!runner.selected(name)) continue;
+        traceEnable(enabled);
+        runner.run(name, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) {
+                SYMBOLIC_TRACE_SCOPE(TracePhase::PRINT_IN_BORDER);
+                sink = sink + i;
+            }
+        });
+    }
+    traceEnable(false);
+}
+
+vector<ScoreEntry> makeEntries(size_t count, Rng& gen) {
+    vector<ScoreEntry> entries(count);
+    for (size_t i = 0; i < count; i++) {
+        entries[i].playerName = "pemain" + to_string(i);
+        entries[i].score = 1 + static_cast<int>(gen.below(5000));
+        entries[i].digits = 3 + static_cast<int>(gen.below(4));
+        entries[i].attempts = 1 + static_cast<int>(gen.below(8));
+        entries[i].timestamp = 1700000000 + static_cast<int64_t>(i);
+    }
+    return entries;
+}
+
+void benchLeaderboard(BenchRunner& runner, const BenchOptions& options) {
+    namespace fs = std::filesystem;
+    vector<size_t> sizes = {10, 10000};
+    if (!options.quick) sizes.push_back(1000000);
+
+    for (size_t size : sizes) {
+        string suffix = "/entries=" + to_string(size);
+        string saveName = "leaderboard/save" + suffix;
+        string loadName = "leaderboard/load" + suffix;
+        string appendName = "leaderboard/append" + suffix;
+        string buildName = "leaderboard/rankingBuild" + suffix;
+        string rankName = "leaderboard/rank" + suffix;
+        string topName = "leaderboard/topPerDigits" + suffix;
+        if (!runner.selected(saveName) && !runner.selected(loadName) && !runner.selected(appendName) &&
+            !runner.selected(buildName) && !runner.selected(rankName) && !runner.selected(topName)) {
+            continue;
+        }
+
+        fs::path dir = fs::path(options.dataDir) / ("leaderboard_" + to_string(size));
+        fs::remove_all(dir);
+        fs::create_directories(dir);
+        string path = (dir / "bench.bin").string();
+
+        Rng gen(4);
+        vector<ScoreEntry> entries = makeEntries(size, gen);
+
+        // Simpan: satu kelompok (satu fsync) lalu pemadatan indeks
+        Clock::time_point start = Clock::now();
+        {
+            LeaderboardStore store(path);
+            store.load("");
+            store.add(entries);
+            store.compact();
+        }
+        double seconds = chrono::duration<double>(Clock::now() - start).count();
+        if (runner.selected(saveName)) {
+            BenchResult& result = runner.record(saveName, 1, seconds);
+            result.counters.push_back({"ns_per_entry", seconds * 1e9 / size});
+        }
+
+        // Muat: membuka log + indeks lewat mmap dan membaca sepuluh teratas
+        if (runner.selected(loadName)) {
+            runner.run(loadName, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; i++) {
+                    LeaderboardStore store(path);
+                    store.load("");
+                    sink = sink + store.top(10).size();
+                }
+            });
+        }
+
+        // Tambah satu skor ke papan yang sudah berisi size skor (termasuk fsync)
+        if (runner.selected(appendName)) {
+            LeaderboardStore store(path);
+            store.load("");
+            ScoreEntry entry = entries[0];
+            runner.run(appendName, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; i++) store.add(entry);
+            }, 200);
+        }
+
+        // Indeks peringkat: pembangunan penuh dari log, lalu kueri O(log k) per tingkat kesulitan
+        if (runner.selected(buildName) || runner.selected(rankName) || runner.selected(topName)) {
+            LeaderboardStore store(path);
+            store.load("");
+            if (runner.selected(buildName)) {
+                BenchResult& result = runner.run(buildName, [&](uint64_t n) {
+                    for (uint64_t i = 0; i < n; i++) {
+                        ScoreRanking ranking;
+                        ranking.update(store);
+                        sink = sink + ranking.size();
+                    }
+                });
+                result.counters.push_back({"ns_per_entry", result.nsPerOp() / static_cast<double>(size)});
+            }
+            const ScoreRanking& ranking = store.rankings();
+            if (runner.selected(rankName)) {
+                runner.run(rankName, [&](uint64_t n) {
+                    for (uint64_t i = 0; i < n; i++) {
+                        const ScoreEntry& entry = entries[i % entries.size()];
+                        sink = sink + ranking.rank({entry.digits, 0}, entry.score).rank;
+                    }
+                });
+            }
+            if (runner.selected(topName)) {
+                runner.run(topName, [&](uint64_t n) {
+                    for (uint64_t i = 0; i < n; i++) {
+                        sink = sink + ranking.top({3 + static_cast<int>(i % 4), 0}, 10).size();
+                    }
+                });
+            }
+        }
+        fs::remove_all(dir);
+    }
+}
+
+// Petunjuk kedua 4 digit: dari buku (mmap + pencarian biner) dibanding pencarian langsung
+void benchBook(BenchRunner& runner, const BenchOptions& options) {
+    namespace fs = std::filesystem;
+    const string openName = "book/open";
+    const string lookupName = "book/lookup/digits=4";
+    const string searchName = "book/search/digits=4";
+    if (!runner.selected(openName) && !runner.selected(lookupName) && !runner.selected(searchName)) return;
+
+    fs::path dir = fs::path(options.dataDir) / "book";
+    fs::create_directories(dir);
+    string path = (dir / "bench.book").string();
+    BookBuildOptions buildOptions;
+    buildOptions.digits = {4};
+    buildOptions.depth = 2;
+    BookBuildStats stats;
+    if (!writeOpeningBook(path, buildOptions, buildOpeningBook(buildOptions, stats))) {
+        cerr << "Tidak bisa menulis " << path << "\n";
+        return;
+    }
+
+    OpeningBook book;
+    if (runner.selected(openName)) {
+        runner.run(openName, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) sink = sink + (book.open(path) ? book.size() : 0);
+        });
+    }
+    book.open(path);
+
+    // Setiap hasil tebakan pertama yang mungkin, bergiliran
+    SolverResult first;
+    book.lookup(4, {}, buildOptions.solver, first);
+    vector<vector<GuessRecord>> histories;
+    Rng gen(8);
+    for (int i = 0; i < 64; i++) {
+        string target = generateTarget(4, gen);
+        if (target == first.guess) continue;
+        histories.push_back({{first.guess, evaluateGuess(target, first.guess), arrowHint(target, first.guess)}});
+    }
+
+    if (runner.selected(lookupName)) {
+        BenchResult& result = runner.run(lookupName, [&](uint64_t n) {
+            SolverResult move;
+            for (uint64_t i = 0; i < n; i++) {
+                if (book.lookup(4, histories[i % histories.size()], buildOptions.solver, move)) sink = sink + 1;
+            }
+        });
+        result.counters.push_back({"positions", static_cast<double>(book.size())});
+    }
+    if (runner.selected(searchName)) {
+        runner.run(searchName, [&](uint64_t n) {
+            SolverResult result;
+            for (uint64_t i = 0; i < n; i++) {
+                if (solveNextGuess(4, histories[i % histories.size()], buildOptions.solver, result)) sink = sink + 1;
+            }
+        }, histories.size());
+    }
+}
+
+// Biaya siaran di jalur frame pemain, dan salinan frame terbaru oleh satu penonton
+void benchBroadcast(BenchRunner& runner, const BenchOptions& options) {
+    namespace fs = std::filesystem;
+    const string publishName = "broadcast/publish/digits=4";
+    const string readName = "broadcast/read/digits=4";
+    if (!runner.selected(publishName) && !runner.selected(readName)) return;
+
+    fs::create_directories(options.dataDir);
+    string path = (fs::path(options.dataDir) / "bench.broadcast").string();
+    BroadcastPublisher publisher;
+    if (!publisher.open(path)) {
+        cerr << "Tidak bisa membuat " << path << "\n";
+        return;
+    }
+
+    Rng gen(21);
+    GameCore core;
+    core.startNewGame(4, 6, gen);
+    for (int i = 0; i < 5; i++) core.submitGuess(generateTarget(4, gen));
+    ScreenBuffer screen;
+    BoardRenderer board(screen);
+    board.configure(4, 80);
+    screen.beginFrame();
+    board.displayBoard(core);
+    board.displayGuessInput("12", "", true);
+    size_t cells = 0;
+    for (size_t r = 0; r < screen.getRowCount(); r++) cells += screen.getLine(r).width();
+
+    if (runner.selected(publishName)) {
+        double allocationsPerFrame = 0;
+        BenchResult& result = runner.run(publishName, [&](uint64_t n) {
+            uint64_t allocationsBefore = allocTotal();
+            for (uint64_t i = 0; i < n; i++) publisher.publish(screen);
+            allocationsPerFrame = static_cast<double>(allocTotal() - allocationsBefore) / n;
+        });
+        result.counters.push_back({"cells_per_frame", static_cast<double>(cells)});
+        result.counters.push_back({"allocs_per_frame", allocationsPerFrame});
+    }
+    if (runner.selected(readName)) {
+        BroadcastViewer viewer;
+        if (!viewer.open(path)) return;
+        ScreenBuffer copy;
+        runner.run(readName, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) {
+                publisher.publish(screen);
+                if (viewer.read(copy)) sink = sink + copy.getRowCount();
+            }
+        });
+    }
+}
+
+void benchRecording(BenchRunner& runner, const BenchOptions& options) {
+    namespace fs = std::filesystem;
+    const string recordName = "recording/record/digits=4";
+    const string scanName = "recording/scan/games=100000";
+    if (!runner.selected(recordName) && !runner.selected(scanName)) return;
+
+    fs::path dir = fs::path(options.dataDir) / "recording";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    string path = (dir / "bench.rec").string();
+
+    Rng gen(6);
+    GameCore core;
+    core.startNewGame(4, 6, gen);
+    for (int i = 0; i < 5; i++) core.submitGuess(generateTarget(4, gen));
+    vector<uint32_t> guessMs = {4200, 9100, 15800, 21000, 30400};
+
+    // Biaya di jalur interaktif saat permainan selesai; penulisan berjalan di thread lain
+    {
+        RecordingWriter writer(path);
+        if (runner.selected(recordName)) {
+            runner.run(recordName, [&](uint64_t n) {
+                for (uint64_t i = 0; i < n; i++) {
+                    GameRecord record;
+                    fillGameRecord(record, core);
+                    record.startedAt = static_cast<int64_t>(i) * 60000;
+                    record.guessMs = guessMs;
+                    writer.record(std::move(record));
+                }
+            });
+        }
+    }
+
+    if (runner.selected(scanName)) {
+        fs::remove(path);
+        {
+            RecordingWriter writer(path);
+            for (int g = 0; g < 100000; g++) {
+                core.startNewGame(4, 6, gen);
+                while (!core.isOver()) core.submitGuess(generateTarget(4, gen));
+                GameRecord record;
+                fillGameRecord(record, core);
+                record.startedAt = static_cast<int64_t>(g) * 60000;
+                record.guessMs = guessMs;
+                writer.record(std::move(record));
+            }
+        }
+        RecordingReader reader;
+        reader.open(path);
+        vector<uint8_t> buffer;
+        vector<GameRecord> decoded;
+        BenchResult& result = runner.run(scanName, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) {
+                for (size_t b = 0; b < reader.blockCount(); b++) {
+                    reader.decodeBlock(b, buffer, decoded, false);
+                    sink = sink + decoded.size();
+                }
+            }
+        });
+        result.counters.push_back({"mib_per_second", reader.getFileSize() / (1024.0 * 1024.0) / (result.nsPerOp() * 1e-9)});
+        result.counters.push_back({"ns_per_game", result.nsPerOp() / 100000});
+    }
+    fs::remove_all(dir);
+}
+
+/*
+ * KESETARAAN UMPAN BALIK (--verify)
+ * Setiap implementasi umpan balik dibandingkan dengan algoritme string
+ * asli (tandai hijau, lalu cari kuning satu per satu). 3 dan 4 digit:
+ * semua pasangan target x tebakan. 5 digit: semua target terhadap setiap
+ * pola kesamaan tebakan (52 pola, masing-masing digeser ke 10 nilai digit),
+ * sehingga setiap hubungan sama/beda antar posisi teruji. Kernel massal
+ * diuji di setiap jalur yang bisa dijalankan mesin ini.
+ */
+
+// Algoritme asli O(n^2) sebelum semua optimasi, sebagai acuan
+string referenceFeedback(const string& target, const string& guess) {
+    string result(guess.length(), ' ');
+    vector<bool> targetUsed(target.length(), false);
+    vector<bool> guessUsed(guess.length(), false);
+    for (size_t i = 0; i < guess.length(); i++) {
+        if (guess[i] == target[i]) {
+            result[i] = 'G';
+            targetUsed[i] = true;
+            guessUsed[i] = true;
+        }
+    }
+    for (size_t i = 0; i < guess.length(); i++) {
+        if (guessUsed[i]) continue;
+        for (size_t j = 0; j < target.length(); j++) {
+            if (!targetUsed[j] && guess[i] == target[j]) {
+                result[i] = 'Y';
+                targetUsed[j] = true;
+                break;
+            }
+        }
+    }
+    for (char& c : result) {
+        if (c == ' ') c = 'X';
+    }
+    return result;
+}
+
+// Pola kesamaan posisi (restricted growth string), digit = (blok + shift) % 10
+void equalityPatterns(int digits, vector<int>& pattern, int blocks, vector<string>& out) {
+    if (static_cast<int>(pattern.size()) == digits) {
+        for (int shift = 0; shift < 10; shift++) {
+            string guess;
+            for (int block : pattern) guess += static_cast<char>('0' + (block + shift) % 10);
+            out.push_back(guess);
+        }
+        return;
+    }
+    for (int block = 0; block <= blocks && block < 10; block++) {
+        pattern.push_back(block);
+        equalityPatterns(digits, pattern, max(blocks, block + 1), out);
+        pattern.pop_back();
+    }
+}
+
+struct VerifyCount {
+    string name;
+    uint64_t checked = 0;
+    uint64_t mismatches = 0;
+};
+
+int verifyFeedback() {
+    int failures = 0;
+    cerr << left << setw(8) << "digit" << setw(22) << "implementasi" << right << setw(14) << "pasangan" << setw(10)
+         << "selisih\n";
+    for (int digits = 3; digits <= 5; digits++) {
+        const uint64_t total = powerOfTen(digits);
+        vector<string> numbers;
+        for (uint64_t value = 0; value < total; value++) {
+            string text = to_string(value);
+            numbers.push_back(string(digits - text.size(), '0') + text);
+        }
+        vector<string> guesses;
+        if (digits <= 4) {
+            guesses = numbers;
+        } else {
+            vector<int> pattern;
+            equalityPatterns(digits, pattern, 0, guesses);
+        }
+        vector<PackedDigits> packed;
+        for (const string& number : numbers) packed.push_back(PackedDigits::fromString(number));
+        const PackedCandidates candidates = PackedCandidates::fromRange(digits, 0, total);
+        const vector<string> kernels = feedbackKernelNames();
+        const GuessEvaluator fixed = guessEvaluator(digits);
+
+        vector<VerifyCount> counts = {{"evaluateGuess"}, {"evaluateGuessCode"}, {"evaluatePacked"},
+                                      {fixed == evaluateGeneric ? "guessEvaluator (umum)" : "guessEvaluator"}};
+        for (const string& kernel : kernels) counts.push_back({"scoreGuessBatch/" + kernel});
+        auto check = [&](VerifyCount& count, bool ok, const string& target, const string& guess) {
+            count.checked++;
+            if (ok) return;
+            if (count.mismatches++ < 3) {
+                cerr << "  " << count.name << ": target " << target << " tebakan " << guess << " seharusnya "
+                     << referenceFeedback(target, guess) << "\n";
+            }
+        };
+
+        vector<uint16_t> batch(total), expected(total);
+        PackedDigits result;
+        uint8_t targetDigits[MAX_KERNEL_DIGITS], guessDigits[MAX_KERNEL_DIGITS];
+        for (const string& guess : guesses) {
+            const PackedDigits packedGuess = PackedDigits::fromString(guess);
+            for (int p = 0; p < digits; p++) guessDigits[p] = static_cast<uint8_t>(guess[p] - '0');
+            for (uint64_t t = 0; t < total; t++) {
+                const string& target = numbers[t];
+                const string reference = referenceFeedback(target, guess);
+                const ArrowHint arrow = guess == target ? ArrowHint::NONE : guess < target ? ArrowHint::UP : ArrowHint::DOWN;
+                expected[t] = feedbackCode(reference);
+
+                check(counts[0], evaluateGuess(target, guess) == reference, target, guess);
+                for (int p = 0; p < digits; p++) targetDigits[p] = static_cast<uint8_t>(target[p] - '0');
+                check(counts[1], evaluateGuessCode(targetDigits, guessDigits, digits) == expected[t], target, guess);
+                evaluatePacked(packed[t], packedGuess, result);
+                check(counts[2], result.toString(FEEDBACK_ALPHABET) == reference &&
+                                     arrowHint(packed[t], packedGuess) == arrow, target, guess);
+                ArrowHint fixedArrow = fixed(packed[t], packedGuess, result);
+                check(counts[3], result.toString(FEEDBACK_ALPHABET) == reference && fixedArrow == arrow, target, guess);
+            }
+            for (size_t k = 0; k < kernels.size(); k++) {
+                setFeedbackKernel(kernels[k]);
+                scoreGuessBatch(guess, candidates, 0, total, batch.data());
+                for (uint64_t t = 0; t < total; t++) check(counts[4 + k], batch[t] == expected[t], numbers[t], guess);
+            }
+        }
+        setFeedbackKernel(kernels.front());
+
+        for (const VerifyCount& count : counts) {
+            cerr << left << setw(8) << digits << setw(22) << count.name << right << setw(14) << count.checked
+                 << setw(10) << count.mismatches << "\n";
+            if (count.mismatches) failures++;
+        }
+    }
+    if (failures) cerr << "GAGAL: " << failures << " implementasi umpan balik berbeda dari algoritme asli\n";
+    return failures ? 1 : 0;
+}
+
+/*
+ * ANGGARAN ALOKASI (--check-allocations)
+ * Setiap skenario mengulang satu operasi setelah pemanasan lalu
+ * membandingkan alokasi heap per operasi dengan anggarannya. Anggaran
+ * bawaan ada di DEFAULT_BUDGETS; --budget FILE menimpa atau menambah per
+ * baris "skenario [fase] maks" (# untuk komentar). Anggaran per fase hanya
+ * diperiksa di build -DSYMBOLIC_ALLOC_ACCOUNTING=ON.
+ */
+struct AllocBudget {
+    string scenario;
+    int phase;        // -1 = semua fase
+    double maxPerOp;
+};
+
+const AllocBudget DEFAULT_BUDGETS[] = {
+    // Frame papan tidak mengalokasikan sama sekali setelah pemanasan
+    {"render/displayBoard/digits=3", -1, 0},
+    {"render/displayBoard/digits=4", -1, 0},
+    {"render/displayBoard/digits=6", -1, 0},
+    {"render/displayBoard/digits=100", -1, 0},
+    {"render/displayBoard/digits=1000", -1, 0},
+    {"evaluate/evaluateGuess/digits=4", -1, 0},
+    // Riwayat terkemas disimpan di dalam objek dan dipesan saat permainan dimulai
+    {"evaluate/submitGuess/digits=4", -1, 0},
+    {"input/keystroke/digits=4", -1, 0},
+    {"input/keystroke/digits=4", static_cast<int>(AllocPhase::RENDER), 0},
+    {"leaderboard/addAndView/entries=1000", -1, 40},
+    {"game/digits=4", -1, 4},
+};
+
+struct AllocScenario {
+    string name;
+    uint64_t ops = 0;
+    AllocCounts counts;
+    uint64_t maxPerKey = 0; // Hanya skenario permainan
+};
+
+// body(i) menjalankan operasi ke-i; pemanasan tidak dihitung
+template <typename Body>
+AllocScenario measureAllocations(const string& name, int warmup, int ops, Body&& body) {
+    for (int i = 0; i < warmup; i++) body(i);
+    AllocScenario scenario;
+    scenario.name = name;
+    scenario.ops = static_cast<uint64_t>(ops);
+    AllocCounts before = allocSnapshot();
+    for (int i = 0; i < ops; i++) body(warmup + i);
+    scenario.counts = allocSnapshot() - before;
+    return scenario;
+}
+
+bool loadBudgets(const string& path, vector<AllocBudget>& budgets) {
+    ifstream file(path);
+    if (!file) return false;
+    string line;
+    while (getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty() || line[0] == '#') continue;
+        istringstream fields(line);
+        string scenario, second, third;
+        fields >> scenario >> second >> third;
+        if (scenario.empty() || second.empty()) continue;
+        AllocBudget budget{scenario, -1, 0};
+        if (!third.empty()) {
+            for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+                if (second == allocPhaseName(static_cast<AllocPhase>(i))) budget.phase = i;
+            }
+            if (budget.phase < 0) {
+                cerr << path << ": fase tidak dikenal '" << second << "'\n";
+                return false;
+            }
+            second = third;
+        }
+        budget.maxPerOp = atof(second.c_str());
+        auto same = [&](const AllocBudget& other) { return other.scenario == budget.scenario && other.phase == budget.phase; };
+        auto existing = find_if(budgets.begin(), budgets.end(), same);
+        if (existing != budgets.end()) *existing = budget;
+        else budgets.push_back(budget);
+    }
+    return true;
+}
+
+// Papan dengan semua percobaan kecuali satu terisi; input, waktu dan sisa kemungkinan berubah setiap frame
+AllocScenario boardScenario(int digits, int attempts, int columns) {
+    Rng gen(17);
+    GameCore core;
+    core.startNewGame(digits, attempts, gen);
+    while (core.getRemainingAttempts() > 1) {
+        string guess = generateTarget(digits, gen);
+        if (guess == core.getTarget()) continue;
+        core.submitGuess(guess);
+    }
+    ScreenBuffer screen;
+    BoardRenderer board(screen);
+    board.configure(digits, columns);
+    string typing = generateTarget(digits, gen), input;
+    const string hint = "Petunjuk: coba angka yang masih mungkin", noHint;
+    input.reserve(typing.size());
+    return measureAllocations("render/displayBoard/digits=" + to_string(digits), 32, 2000, [&](int i) {
+        screen.beginFrame();
+        board.displayBoard(core, 1000 * i, i % 7 == 0 ? -1 : 5000 - i);
+        input.assign(typing, 0, static_cast<size_t>(i % (digits + 1)));
+        board.displayGuessInput(input, i % 3 == 0 ? hint : noHint, true, i % 2 == 0);
+        sink = sink + screen.composeFrame().size();
+    });
+}
+
+// Seperti getGuessInput: setiap tombol mengisi snapshot lalu thread render menggambarnya
+void publishKey(BoardPresenter& presenter, const GameCore& core, const string& input) {
+    SYMBOLIC_ALLOC_SCOPE(AllocPhase::INPUT);
+    BoardSnapshot& snapshot = presenter.next();
+    snapshot.core = core;
+    snapshot.input = input;
+    snapshot.hintText.clear();
+    snapshot.elapsedMs = -1;
+    snapshot.remaining = -1;
+    snapshot.columns = 80;
+    snapshot.hintKey = snapshot.candidatesKey = true;
+    snapshot.showLatency = false;
+    presenter.publish();
+    presenter.waitIdle();
+}
+
+vector<AllocScenario> runAllocScenarios(const BenchOptions& options) {
+    namespace fs = std::filesystem;
+    vector<AllocScenario> scenarios;
+    struct BoardCase {
+        int digits, attempts, columns;
+    };
+    for (const BoardCase& boardCase : {BoardCase{3, 6, 0}, BoardCase{4, 6, 80}, BoardCase{6, 8, 120},
+                                       BoardCase{100, 10, 80}, BoardCase{1000, 10, 200}}) {
+        scenarios.push_back(boardScenario(boardCase.digits, boardCase.attempts, boardCase.columns));
+    }
+
+    Rng gen(23);
+    vector<string> targets, guesses;
+    for (int i = 0; i < 256; i++) {
+        targets.push_back(generateTarget(4, gen));
+        guesses.push_back(generateTarget(4, gen));
+    }
+    scenarios.push_back(measureAllocations("evaluate/evaluateGuess/digits=4", 64, 10000, [&](int i) {
+        sink = sink + evaluateGuess(targets[i % 256], guesses[i % 256]).size();
+    }));
+
+    GameCore core;
+    scenarios.push_back(measureAllocations("evaluate/submitGuess/digits=4", 64, 6000, [&](int i) {
+        if (i % 6 == 0) core.startNewGame(4, 6, targets[i % 256]);
+        core.submitGuess(guesses[i % 256]);
+    }));
+
+    // Mengetik empat digit lalu menghapusnya lagi di papan dengan tiga tebakan
+    BoardPresenter presenter([](const string& frame) { sink = sink + frame.size(); });
+    core.startNewGame(4, 6, targets[0]);
+    for (int i = 1; i <= 3; i++) core.submitGuess(guesses[i]);
+    string input;
+    input.reserve(4);
+    scenarios.push_back(measureAllocations("input/keystroke/digits=4", 64, 2000, [&](int i) {
+        if (i % 8 < 4) input += static_cast<char>('1' + i % 8);
+        else input.pop_back();
+        publishKey(presenter, core, input);
+    }));
+
+    fs::path dir = fs::path(options.dataDir) / "alloc_leaderboard";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    LeaderboardStore store((dir / "scores.bin").string());
+    store.add(makeEntries(1000, gen));
+    store.load();
+    scenarios.push_back(measureAllocations("leaderboard/addAndView/entries=1000", 8, 200, [&](int i) {
+        ScoreEntry entry{"pemain" + to_string(i % 50), 100 + i, 4, 6, 0, 0};
+        store.add(entry);
+        store.refresh();
+        LeaderboardView view = leaderboardView(store, {4, 6}, 10, {entry.playerName, entry.score, 4, 6});
+        sink = sink + view.entries.size();
+    }));
+
+    // Permainan utuh lewat jalur game: setiap digit satu tombol, Enter menilai tebakan
+    CandidateTracker candidates;
+    AllocTracker tracker;
+    uint64_t maxPerKey = 0;
+    AllocScenario game = measureAllocations("game/digits=4", 4, 100, [&](int i) {
+        tracker.beginGame();
+        core.startNewGame(4, 6, targets[i % 256]);
+        candidates.reset(4);
+        for (int attempt = 0; !core.isOver(); attempt++) {
+            const string& guess = guesses[(i + attempt * 31) % 256];
+            input.clear();
+            for (char ch : guess) {
+                tracker.keystroke();
+                input += ch;
+                publishKey(presenter, core, input);
+            }
+            tracker.keystroke();
+            core.submitGuess(input);
+            candidates.sync(core);
+            input.clear();
+            publishKey(presenter, core, input);
+        }
+        maxPerKey = max(maxPerKey, tracker.endGame().maxPerKey);
+    });
+    game.maxPerKey = maxPerKey;
+    scenarios.push_back(game);
+    return scenarios;
+}
+
+int checkAllocations(const BenchOptions& options) {
+    vector<AllocBudget> budgets(begin(DEFAULT_BUDGETS), end(DEFAULT_BUDGETS));
+    if (!options.budgetPath.empty() && !loadBudgets(options.budgetPath, budgets)) {
+        cerr << "Tidak bisa membaca anggaran " << options.budgetPath << "\n";
+        return 1;
+    }
+
+#ifdef SYMBOLIC_ALLOC_ACCOUNTING
+    const bool phases = true;
+#else
+    const bool phases = false;
+#endif
+    int failures = 0;
+    cerr << left << setw(38) << "skenario" << right << setw(8) << "operasi" << setw(12) << "alokasi/op" << setw(12)
+         << "byte/op" << setw(10) << "anggaran" << "  hasil\n";
+    for (const AllocScenario& scenario : runAllocScenarios(options)) {
+        double ops = static_cast<double>(scenario.ops);
+        double perOp = static_cast<double>(scenario.counts.totalAllocations()) / ops;
+        double bytesPerOp = static_cast<double>(scenario.counts.totalBytes()) / ops;
+        string budgetText = "-", verdict = "tanpa anggaran";
+        for (const AllocBudget& budget : budgets) {
+            if (budget.scenario != scenario.name || budget.phase >= 0) continue;
+            bool ok = perOp <= budget.maxPerOp;
+            ostringstream text;
+            text << budget.maxPerOp;
+            budgetText = text.str();
+            verdict = ok ? "OK" : "GAGAL";
+            if (!ok) failures++;
+        }
+        cerr << left << setw(38) << scenario.name << right << setw(8) << scenario.ops << setw(12) << fixed
+             << setprecision(2) << perOp << setw(12) << setprecision(0) << bytesPerOp << setw(10) << budgetText
+             << "  " << verdict << "\n";
+        if (scenario.maxPerKey) cerr << "    maks per tombol: " << scenario.maxPerKey << "\n";
+        if (!phases) continue;
+        for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+            double phasePerOp = static_cast<double>(scenario.counts.allocations[i]) / ops;
+            string phaseVerdict;
+            for (const AllocBudget& budget : budgets) {
+                if (budget.scenario != scenario.name || budget.phase != i) continue;
+                bool ok = phasePerOp <= budget.maxPerOp;
+                ostringstream text;
+                text << (ok ? "  OK" : "  GAGAL") << " (anggaran " << defaultfloat << budget.maxPerOp << ")";
+                phaseVerdict = text.str();
+                if (!ok) failures++;
+            }
+            if (scenario.counts.allocations[i] == 0 && phaseVerdict.empty()) continue;
+            cerr << "    " << left << setw(12) << allocPhaseName(static_cast<AllocPhase>(i)) << right << setw(10)
+                 << setprecision(2) << phasePerOp << " alokasi/op" << phaseVerdict << "\n";
+        }
+    }
+    if (failures) cerr << "GAGAL: " << failures << " anggaran alokasi terlampaui\n";
+    return failures ? 1 : 0;
+}
+
+string jsonEscape(const string& text) {
+    string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        if (static_cast<unsigned char>(c) < 0x20) continue;
+        out += c;
+    }
+    return out;
+}
+
+void writeJson(ostream& out, const vector<BenchResult>& results, const BenchOptions& options) {
+    time_t now = time(nullptr);
+    char date[32];
+    strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    out << setprecision(6) << defaultfloat;
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": \"" << date << "\",\n"
+        << "    \"feedback_kernel\": \"" << feedbackKernelName() << "\",\n"
+        << "    \"tracing_compiled\": " << (traceCompiled() ? "true" : "false") << ",\n"
+        << "    \"hardware_threads\": " << thread::hardware_concurrency() << ",\n"
+#ifdef __VERSION__
+        << "    \"compiler\": \"" << jsonEscape(__VERSION__) << "\",\n"
+#endif
+#ifdef NDEBUG
+        << "    \"assertions\": false,\n"
+#else
+        << "    \"assertions\": true,\n"
+#endif
+        << "    \"min_time_seconds\": " << options.minSeconds << "\n  },\n";
+    out << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& result = results[i];
+        out << (i ? ",\n" : "\n") << "    {\"name\": \"" << jsonEscape(result.name) << "\", \"iterations\": "
+            << result.iterations << ", \"seconds\": " << result.seconds << ", \"ns_per_op\": " << result.nsPerOp();
+        for (const auto& counter : result.counters) out << ", \"" << counter.first << "\": " << counter.second;
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " [opsi]\n"
+         << "  --out FILE        Tulis JSON ke file (bawaan: stdout)\n"
+         << "  --filter TEKS     Hanya benchmark yang namanya memuat TEKS\n"
+         << "  --min-time DETIK  Waktu minimum per benchmark (bawaan: 0.2)\n"
+         << "  --quick           Lewati papan peringkat 1M skor\n"
+         << "  --dir PATH        Folder data sementara (bawaan: folder temp sistem)\n"
+         << "  --check-allocations  Hanya memeriksa anggaran alokasi per skenario (gagal jika terlampaui)\n"
+         << "  --budget FILE     Anggaran tambahan/pengganti: baris \"skenario [fase] maks\"\n"
+         << "  --verify          Hanya membandingkan semua implementasi umpan balik dengan algoritme asli\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--out") == 0 && hasValue) options.outPath = argv[++i];
+        else if (strcmp(arg, "--filter") == 0 && hasValue) options.filter = argv[++i];
+        else if (strcmp(arg, "--min-time") == 0 && hasValue) options.minSeconds = atof(argv[++i]);
+        else if (strcmp(arg, "--quick") == 0) options.quick = true;
+        else if (strcmp(arg, "--dir") == 0 && hasValue) options.dataDir = argv[++i];
+        else if (strcmp(arg, "--check-allocations") == 0) options.checkAllocations = true;
+        else if (strcmp(arg, "--verify") == 0) options.verify = true;
+        else if (strcmp(arg, "--budget") == 0 && hasValue) options.budgetPath = argv[++i];
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (options.dataDir.empty()) {
+        options.dataDir = (std::filesystem::temp_directory_path() / "symbolic_bench").string();
+    }
+    if (options.checkAllocations) return checkAllocations(options);
+    if (options.verify) return verifyFeedback();
+
+    BenchRunner runner(options);
+    benchEvaluate(runner);
+    benchMarathon(runner);
+    benchBatch(runner);
+    benchRandom(runner);
+    benchCandidates(runner);
+    benchBoard(runner);
+    benchRender(runner);
+    benchVisualLength(runner);
+    benchTraceScope(runner);
+    benchLeaderboard(runner, options);
+    benchRecording(runner, options);
+    benchBook(runner, options);
+    benchBroadcast(runner, options);
+
+    if (options.outPath.empty()) {
+        writeJson(cout, runner.getResults(), options);
+    } else {
+        ofstream file(options.outPath);
+        writeJson(file, runner.getResults(), options);
+        if (!file) {
+            cerr << "Tidak bisa menulis " << options.outPath << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,393 @@
+#include "symbolic_board.h"
+#include "symbolic_trace.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+
+using namespace std;
+
+namespace {
+
+// Warna glif berdasarkan huruf umpan balik
+GlyphColor feedbackColor(const string& feedback, size_t index) {
+    if (index >= feedback.size()) return GLYPH_PLAIN;
+    switch (feedback[index]) {
+        case 'G': return GLYPH_GREEN;
+        case 'Y': return GLYPH_YELLOW;
+        case 'X': return GLYPH_RED;
+        default: return GLYPH_PLAIN;
+    }
+}
+
+// GlyphColor -> warna sel layar
+constexpr uint8_t GLYPH_SCREEN_COLORS[GLYPH_COLOR_COUNT] = {COLOR_RESET, COLOR_GREEN,   COLOR_YELLOW,
+                                                            COLOR_RED,   COLOR_MAGENTA, COLOR_CYAN};
+
+// Seperti setw dengan left: teks dirata kiri lalu diisi spasi sampai selebar kolom
+template <typename T>
+void appendColumn(ScreenLine& line, const T& value, size_t width) {
+    size_t start = line.width();
+    line << value;
+    if (line.width() < start + width) line.fill(' ', start + width - line.width());
+}
+
+} // namespace
+
+string formatElapsed(int64_t elapsedMs) {
+    char text[32];
+    snprintf(text, sizeof text, "%lld.%03lld s", static_cast<long long>(elapsedMs / 1000),
+             static_cast<long long>(elapsedMs % 1000));
+    return text;
+}
+
+string formatDuration(uint64_t ns) {
+    char text[32];
+    if (ns < 1000) snprintf(text, sizeof text, "%llu ns", static_cast<unsigned long long>(ns));
+    else if (ns < 1000000) snprintf(text, sizeof text, "%.2f us", ns / 1e3);
+    else if (ns < 1000000000) snprintf(text, sizeof text, "%.2f ms", ns / 1e6);
+    else snprintf(text, sizeof text, "%.2f s", ns / 1e9);
+    return text;
+}
+
+int getVisualLength(const string& text) {
+    int length = 0;
+    bool inColorCode = false;
+    for (char c : text) {
+        if (c == '\033') {
+            inColorCode = true;
+        } else if (inColorCode && c == 'm') {
+            inColorCode = false;
+        } else if (!inColorCode) {
+            length++;
+        }
+    }
+    return length;
+}
+
+void BoardRenderer::configure(int newDigits, int columns) {
+    digits = newDigits;
+    const int oldWidth = borderWidth;
+    const GlyphStyle* oldGlyphs = glyphs;
+
+    if (newDigits >= MARATHON_MIN_DIGITS) {
+        // Maraton: bingkai selebar terminal, glif terbesar yang muat dalam beberapa baris
+        borderWidth = columns > 0 ? max(24, columns) : 80;
+        if (newDigits * 10 + 20 <= borderWidth) {
+            glyphs = &LARGE_GLYPHS;
+        } else {
+            glyphs = &COMPACT_GLYPHS;
+            if (glyphsPerLine(ArrowHint::UP) * 4 < static_cast<size_t>(newDigits)) glyphs = &TINY_GLYPHS;
+        }
+    } else {
+        // Glif ringkas jika papan dengan glif besar tidak muat di lebar terminal
+        int largeWidth = max(80, newDigits * 10 + 20);
+        glyphs = (columns > 0 && largeWidth > columns) ? &COMPACT_GLYPHS : &LARGE_GLYPHS;
+        borderWidth = (glyphs == &LARGE_GLYPHS) ? largeWidth : max(newDigits * 4 + 20, min(columns, 80));
+    }
+
+    // Blok tebakan yang tersimpan hanya berlaku untuk bingkai dan glif yang sama
+    if (borderWidth != oldWidth || glyphs != oldGlyphs) {
+        for (HistoryBlock& block : history) block.gameId = 0;
+    }
+}
+
+void BoardRenderer::printBorder(bool top, bool bottom) {
+    char borderChar = (top || bottom) ? '=' : '-';
+    screen.newLine().setColor(COLOR_CYAN).fill('+', 1).fill(borderChar, static_cast<size_t>(borderWidth - 2)).fill('+', 1);
+}
+
+void BoardRenderer::printInBorder(const ScreenLine& text, bool center) {
+    SYMBOLIC_TRACE_SCOPE(TracePhase::PRINT_IN_BORDER);
+    // Lebar visual sudah diketahui dari jumlah sel, tidak perlu memindai kode warna
+    int padding = max(1, borderWidth - 2 - static_cast<int>(text.width())); // Teks terlalu panjang dibiarkan meluber
+    int leftPad = center ? padding / 2 : 1;
+    ScreenLine& row = screen.newLine();
+    row.setColor(COLOR_CYAN) << '|';
+    row.setColor(COLOR_RESET).fill(' ', static_cast<size_t>(leftPad)) << text;
+    row.fill(' ', static_cast<size_t>(padding - leftPad));
+    row.setColor(COLOR_CYAN) << '|';
+}
+
+void BoardRenderer::printInBorder(string_view text, bool center) {
+    printInBorder(line() << text, center);
+}
+
+void BoardRenderer::printEmptyBorderLine() {
+    ScreenLine& row = screen.newLine();
+    row.setColor(COLOR_CYAN) << '|';
+    row.fill(' ', static_cast<size_t>(borderWidth - 2)) << '|';
+}
+
+size_t BoardRenderer::glyphsPerLine(ArrowHint hint) const {
+    const GlyphStyle& style = *glyphs;
+    int available = borderWidth - 4; // Bingkai dan satu spasi di kiri-kanan
+    if (hint != ArrowHint::NONE) available -= style.arrows.width + 3;
+    // Glif satu kolom dikelompokkan per sepuluh, glif lain diberi spasi masing-masing
+    if (style.digits.width == 1) return static_cast<size_t>(max(1, available / (TINY_GROUP + 1)) * TINY_GROUP);
+    return static_cast<size_t>(max(1, available / (style.digits.width + 1)));
+}
+
+size_t BoardRenderer::glyphRowCount(size_t cells, ArrowHint hint) const {
+    size_t perLine = glyphsPerLine(hint);
+    return static_cast<size_t>(glyphs->digits.rows) * max<size_t>(1, (cells + perLine - 1) / perLine);
+}
+
+void BoardRenderer::displayGlyphs(const string& number, const string& feedback, bool isInput, ArrowHint hint) {
+    SYMBOLIC_TRACE_SCOPE(TracePhase::GLYPHS);
+    const GlyphFont& font = glyphs->digits;
+    const bool grouped = font.width == 1;
+
+    // Posisi umpan balik dihitung dari digit saja, karakter lain dilewati
+    size_t digitCount = 0;
+    for (char digitChar : number) digitCount += isdigit(static_cast<unsigned char>(digitChar)) ? 1 : 0;
+    size_t cells = isInput ? max(digitCount, static_cast<size_t>(digits)) : digitCount;
+    size_t perLine = glyphsPerLine(hint);
+
+    // Angka panjang dibungkus menjadi beberapa baris glif selebar bingkai
+    size_t next = 0; // Indeks karakter berikutnya di number
+    for (size_t first = 0; first < cells || first == 0; first += perLine) {
+        size_t last = min(cells, first + perLine);
+        size_t chunkStart = next;
+        for (int j = 0; j < font.rows; j++) {
+            glyphRow.clear();
+            size_t cursor = chunkStart;
+            for (size_t cell = first; cell < last; cell++) {
+                // Seni glif disalin langsung sebagai sel berwarna, tanpa kode ANSI yang diurai ulang
+                if (cell < digitCount) {
+                    while (!isdigit(static_cast<unsigned char>(number[cursor]))) cursor++;
+                    GlyphColor color = isInput ? GLYPH_MAGENTA : feedbackColor(feedback, cell);
+                    glyphRow.setColor(GLYPH_SCREEN_COLORS[color]).appendPlain(font.row(number[cursor] - '0', j));
+                    cursor++;
+                } else {
+                    glyphRow.setColor(COLOR_CYAN).appendPlain(font.row(GLYPH_PLACEHOLDER, j));
+                }
+                glyphRow.setColor(COLOR_RESET);
+                if (!grouped || (cell + 1 - first) % TINY_GROUP == 0) glyphRow << ' ';
+            }
+            if (hint != ArrowHint::NONE && last == cells) {
+                glyphRow << "  ";
+                glyphRow.appendPlain(glyphs->arrows.row(hint == ArrowHint::UP ? GLYPH_ARROW_UP : GLYPH_ARROW_DOWN, j));
+                glyphRow << ' ';
+            }
+            printInBorder(glyphRow, true);
+            next = cursor;
+        }
+        if (cells == 0) break;
+    }
+}
+
+void BoardRenderer::displaySymbolicNumber(const string& number, const string& feedback, bool isInput) {
+    displayGlyphs(number, feedback, isInput, ArrowHint::NONE);
+}
+
+void BoardRenderer::displayArrowHint(const string& guess, const string& feedback, ArrowHint hint) {
+    if (hint == ArrowHint::NONE) return;
+    displayGlyphs(guess, feedback, false, hint);
+}
+
+void BoardRenderer::displayHistoryBlock(const GameCore& core, size_t attempt) {
+    if (history.size() <= attempt) history.resize(attempt + 1);
+    HistoryBlock& block = history[attempt];
+    if (block.gameId == core.getGameId()) {
+        for (const ScreenLine& cached : block.rows) screen.newLine() << cached;
+        return;
+    }
+
+    // Belum tersimpan: gambar seperti biasa lalu salin baris-barisnya dari layar
+    size_t firstRow = screen.getRowCount();
+    core.getPackedGuess(attempt).toString(guessText);
+    core.getPackedResult(attempt).toString(resultText, FEEDBACK_ALPHABET);
+    printInBorder(line() << "Percobaan " << attempt + 1 << ":", false);
+    if (core.getHints()[attempt] != ArrowHint::NONE) {
+        displayArrowHint(guessText, resultText, core.getHints()[attempt]);
+    } else {
+        displaySymbolicNumber(guessText, resultText);
+    }
+
+    size_t rows = screen.getRowCount() - firstRow;
+    block.rows.resize(rows);
+    for (size_t r = 0; r < rows; r++) block.rows[r].clear() << screen.getLine(firstRow + r);
+    block.gameId = core.getGameId();
+}
+
+void BoardRenderer::displayMenu() {
+    screen.addLine("");
+    screen.addLine("+============================================================+");
+    screen.addLine("|           Selamat Datang di SYMBOLIC NUMBLER!              |");
+    screen.addLine("+============================================================+");
+    screen.addLine("");
+    screen.addLine("Pilih Menu:");
+    screen.addLine("1. Mudah (3 digit, 6 percobaan)");
+    screen.addLine("2. Sedang (4 digit, 6 percobaan)");
+    screen.addLine("3. Sulit (5 digit, 6 percobaan)");
+    screen.addLine("4. Ahli (6 digit, 8 percobaan)");
+    screen.addLine("5. Kustom");
+    screen.addLine("6. Papan Peringkat");
+    screen.addLine("7. Speedrun (4 digit, 6 percobaan, skor menurut waktu)");
+    screen.newLine() << "8. Maraton (" << MARATHON_MIN_DIGITS << "-" << MARATHON_MAX_DIGITS << " digit)";
+    screen.newLine() << "D. Tantangan harian (" << DAILY_DIGITS << " digit, " << DAILY_ATTEMPTS
+                     << " percobaan, target sama untuk semua pemain)";
+    screen.addLine("9. Keluar");
+}
+
+void BoardRenderer::displayInstructions(const GameCore& core, bool hintKey, bool timed) {
+    printBorder(true);
+    printInBorder("INSTRUKSI SYMBOLIC NUMBLER", true);
+    printBorder();
+    printInBorder(line() << "* Tebak angka rahasia " << core.getDigits() << "-digit.", false);
+    printInBorder(line() << "* Anda memiliki " << core.getMaxAttempts() << " percobaan.", false);
+    printInBorder(line() << "* " << GREEN << "HIJAU" << RESET << ": Digit & posisi benar.", false);
+    printInBorder(line() << "* " << YELLOW << "KUNING" << RESET << ": Digit benar, posisi salah.", false);
+    printInBorder(line() << "* " << RED << "MERAH" << RESET << ": Digit salah.", false);
+    printInBorder("* Panah akan menunjukkan angka rahasia lebih tinggi atau rendah.", false);
+    if (hintKey) printInBorder("* Tekan H saat menebak untuk meminta petunjuk.", false);
+    if (timed) printInBorder("* Speedrun: waktu mulai saat papan muncul; makin cepat, makin tinggi skor.", false);
+    if (core.isMarathon()) printInBorder("* Maraton: angka panjang boleh ditempel sekaligus.", false);
+    printBorder(false, true);
+}
+
+void BoardRenderer::displayBoard(const GameCore& core, int64_t elapsedMs, int64_t remaining) {
+    printBorder(true);
+    printInBorder("S Y M B O L I C   N U M B L E R", true);
+    printInBorder(line() << "Tebak angka " << core.getDigits() << "-digit!", true);
+    printBorder();
+    printInBorder(line() << "Legenda: " << GREEN << "Hijau" << RESET << "=Benar, " << YELLOW << "Kuning" << RESET
+                         << "=Posisi Salah, " << RED << "Merah" << RESET << "=Salah", true);
+    printBorder();
+
+    const size_t count = core.getGuessCount();
+    if (count > 0) {
+        printInBorder("Tebakan sebelumnya:", false);
+        printEmptyBorderLine();
+
+        // Di mode maraton hanya beberapa tebakan terakhir agar papan tetap muat di layar
+        size_t shown = max<size_t>(1, min(MARATHON_HISTORY, MARATHON_HISTORY_DIGITS / static_cast<size_t>(core.getDigits())));
+        size_t first = (core.isMarathon() && count > shown) ? count - shown : 0;
+
+        // Terminal pendek: tebakan terlama disembunyikan sampai papan dan input muat
+        // (baris terakhir terminal untuk kursor); tebakan terakhir selalu tampil
+        if (screen.getHeight() > 0) {
+            const size_t cells = static_cast<size_t>(core.getDigits());
+            const size_t available = screen.getHeight() - 1;
+            size_t used = BOARD_FIXED_ROWS + INPUT_FIXED_ROWS + glyphRowCount(cells, ArrowHint::NONE);
+            for (size_t i = first; i < count; i++) used += 2 + glyphRowCount(cells, core.getHints()[i]);
+            used -= 1; // Tanpa baris kosong setelah tebakan terakhir
+            if (used > available && first == 0) used += 2; // Catatan tebakan tersembunyi
+            while (used > available && first + 1 < count) {
+                used -= 2 + glyphRowCount(cells, core.getHints()[first]);
+                first++;
+            }
+        }
+        if (first > 0) {
+            printInBorder(line() << "(" << first << " tebakan sebelumnya disembunyikan)", false);
+            printEmptyBorderLine();
+        }
+        for (size_t i = first; i < count; i++) {
+            displayHistoryBlock(core, i);
+            if (i < count - 1) printEmptyBorderLine();
+        }
+        printBorder();
+    }
+
+    ScreenLine& status = line() << "Sisa percobaan: " << core.getRemainingAttempts();
+    if (elapsedMs >= 0) status << "   Waktu: " << formatElapsed(elapsedMs);
+    if (remaining >= 0) status << "   Kemungkinan: " << remaining;
+    printInBorder(status, true);
+    printBorder();
+}
+
+void BoardRenderer::displayGuessInput(const string& input, const string& hintText, bool hintKey,
+                                      bool candidatesKey) {
+    printInBorder("Tebakan saat ini:", false);
+    displaySymbolicNumber(input, "", true);
+    printBorder();
+    if (!hintText.empty()) {
+        printInBorder(line() << YELLOW << hintText << RESET, true);
+        printBorder();
+    }
+    printInBorder("Ketik 0-9, Backspace untuk hapus, Enter untuk kirim, Q untuk keluar", true);
+    if (hintKey) printInBorder("Tekan H untuk petunjuk tebakan terbaik", true);
+    if (candidatesKey) printInBorder("Tekan K untuk melihat angka yang masih mungkin", true);
+    printBorder(false, true);
+}
+
+void BoardRenderer::displayTraceOverlay(const string& footer) {
+    printInBorder(line() << MAGENTA << "LATENSI (T untuk menutup)" << RESET, false);
+    if (!traceCompiled()) {
+        printInBorder("Pelacakan tidak dikompilasi (SYMBOLIC_TRACING=OFF).", false);
+        if (!footer.empty()) printInBorder(footer, false);
+        printBorder(false, true);
+        return;
+    }
+    char text[96];
+    snprintf(text, sizeof text, "%-14s %8s %10s %10s %10s", "Fase", "Jumlah", "p50", "p99", "Maks");
+    printInBorder(text, false);
+    for (int i = 0; i < TRACE_PHASE_COUNT; i++) {
+        TracePhase phase = static_cast<TracePhase>(i);
+        TraceSummary summary = traceSummary(phase);
+        snprintf(text, sizeof text, "%-14s %8llu %10s %10s %10s", tracePhaseName(phase),
+                 static_cast<unsigned long long>(summary.count), formatDuration(summary.p50).c_str(),
+                 formatDuration(summary.p99).c_str(), formatDuration(summary.max).c_str());
+        printInBorder(text, false);
+    }
+    if (!footer.empty()) printInBorder(footer, false);
+    printBorder(false, true);
+}
+
+void BoardRenderer::displayNotice(const string& message) {
+    printBorder(true);
+    printInBorder(line() << RED << message << RESET, true);
+    printBorder(false, true);
+}
+
+void BoardRenderer::displayStats(const GameCore& core, bool won, int64_t elapsedMs) {
+    printBorder(true);
+    if (won) {
+        printInBorder("*** SELAMAT! ***", true);
+        printInBorder(line() << "Anda menebaknya dalam " << core.getCurrentAttempt() << " percobaan!", true);
+    } else {
+        printInBorder("*** PERMAINAN BERAKHIR! ***", true);
+        printInBorder("Angkanya adalah:", true);
+    }
+    if (elapsedMs >= 0) printInBorder(line() << "Waktu: " << formatElapsed(elapsedMs), true);
+    printBorder();
+    displaySymbolicNumber(core.getTarget());
+    printBorder(false, true);
+}
+
+void BoardRenderer::displayLeaderboard(const LeaderboardView& view) {
+    printBorder(true);
+    printInBorder(view.title, true);
+    printBorder();
+
+    if (view.entries.empty()) {
+        printInBorder("Papan peringkat masih kosong. Jadilah yang pertama!", true);
+    } else {
+        size_t filler = static_cast<size_t>(max(0, borderWidth - 74));
+        ScreenLine& header = screen.newLine() << CYAN << "| " << RESET;
+        appendColumn(header, "No.", 5);
+        appendColumn(header, "Nama", 20);
+        appendColumn(header, "Skor", 15);
+        appendColumn(header, "Digit", 15);
+        appendColumn(header, "Percobaan", 15);
+        header.fill(' ', filler) << CYAN << "|";
+        printBorder();
+        for (size_t i = 0; i < view.entries.size(); i++) {
+            const ScoreEntry& entry = view.entries[i];
+            ScreenLine& row = screen.newLine() << CYAN << "| " << RESET;
+            appendColumn(row, line() << view.ranks[i] << ".", 5);
+            appendColumn(row, entry.playerName, 20);
+            appendColumn(row, entry.score, 15);
+            appendColumn(row, entry.digits, 15);
+            appendColumn(row, entry.attempts, 15);
+            row.fill(' ', filler) << CYAN << "|";
+        }
+    }
+
+    if (!view.notes.empty()) {
+        printBorder();
+        for (const string& note : view.notes) printInBorder(note, false);
+    }
+    printBorder(false, true);
+}
@@ -0,0 +1,114 @@
+/*
+ * SYMBOLIC NUMBLER - PENYUSUN TAMPILAN PAPAN
+ *
+ * Semua layar permainan (menu, instruksi, papan, hasil, papan peringkat)
+ * disusun baris per baris ke ScreenBuffer. Tidak membaca input dan tidak
+ * menulis ke terminal, sehingga bisa dipakai oleh game di konsol maupun
+ * oleh sesi jaringan di server.
+ */
+#ifndef SYMBOLIC_BOARD_H
+#define SYMBOLIC_BOARD_H
+
+#include "symbolic_core.h"
+#include "symbolic_glyphs.h"
+#include "symbolic_leaderboard.h"
+#include "symbolic_screen.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Menghitung panjang visual (mengabaikan kode warna ANSI)
+int getVisualLength(const std::string& text);
+
+// Waktu speedrun, misalnya "12.345 s"
+std::string formatElapsed(int64_t elapsedMs);
+
+// Durasi singkat dengan satuan yang sesuai, misalnya "850 ns" atau "1.25 ms"
+std::string formatDuration(uint64_t ns);
+
+class BoardRenderer {
+private:
+    ScreenBuffer& screen;
+    int digits = 4;
+    int borderWidth = 80;
+    const GlyphStyle* glyphs = &LARGE_GLYPHS;
+
+    // Dipakai ulang setiap frame agar menggambar tidak mengalokasikan memori
+    ScreenLine glyphRow;   // Satu baris angka
+    ScreenLine lineText;   // Teks yang sedang disusun untuk printInBorder
+    std::string guessText, resultText;
+
+    // Blok tebakan yang sudah selesai ("Percobaan N:" dan baris glifnya, sudah
+    // berbingkai) tidak pernah berubah selama permainan yang sama, jadi digambar
+    // sekali lalu hanya disalin. Dibuang saat lebar/glif berubah atau permainan baru.
+    struct HistoryBlock {
+        uint64_t gameId = 0; // 0 = kosong
+        std::vector<ScreenLine> rows;
+    };
+    std::vector<HistoryBlock> history; // Per indeks percobaan
+
+    void displayHistoryBlock(const GameCore& core, size_t attempt);
+
+    // lineText yang sudah dikosongkan
+    ScreenLine& line() { return lineText.clear(); }
+
+    static constexpr int TINY_GROUP = 10;         // Glif mini dikelompokkan per sepuluh digit
+    static constexpr size_t MARATHON_HISTORY = 3;          // Tebakan terakhir yang tampil di mode maraton
+    static constexpr size_t MARATHON_HISTORY_DIGITS = 600; // ...dan total digitnya paling banyak ini
+    // Baris papan di luar blok tebakan dan glif input: kepala (6), judul riwayat (2),
+    // garis (1), status (2), lalu input: judul, garis, petunjuk (2), bantuan (3), garis bawah
+    static constexpr size_t BOARD_FIXED_ROWS = 11;
+    static constexpr size_t INPUT_FIXED_ROWS = 8;
+
+    // Jumlah glif per baris layar sebelum angka dibungkus
+    size_t glyphsPerLine(ArrowHint hint) const;
+    // Baris layar untuk cells glif, termasuk pembungkusan
+    size_t glyphRowCount(size_t cells, ArrowHint hint) const;
+    void displayGlyphs(const std::string& number, const std::string& feedback, bool isInput, ArrowHint hint);
+
+public:
+    // KONSTANTA WARNA ANSI
+    static constexpr const char* GREEN = "\033[32m";
+    static constexpr const char* YELLOW = "\033[33m";
+    static constexpr const char* RED = "\033[31m";
+    static constexpr const char* CYAN = "\033[36m";
+    static constexpr const char* MAGENTA = "\033[35m";
+    static constexpr const char* RESET = "\033[0m";
+
+    explicit BoardRenderer(ScreenBuffer& target) : screen(target) {}
+
+    // Memilih ukuran glif dan lebar bingkai; columns 0 berarti lebar tidak diketahui.
+    // Mode maraton memakai lebar terminal dan membungkus angka ke beberapa baris.
+    void configure(int newDigits, int columns);
+
+    int getBorderWidth() const { return borderWidth; }
+    const GlyphStyle& getGlyphs() const { return *glyphs; }
+
+    // BINGKAI DAN TEKS
+    void printBorder(bool top = false, bool bottom = false);
+    void printInBorder(const ScreenLine& text, bool center = true);
+    void printInBorder(std::string_view text, bool center = true);
+    void printEmptyBorderLine();
+
+    // Angka dalam seni ASCII (dibungkus jika lebih lebar dari bingkai);
+    // isInput menambah kotak kosong sampai jumlah digit
+    void displaySymbolicNumber(const std::string& number, const std::string& feedback = "", bool isInput = false);
+    void displayArrowHint(const std::string& guess, const std::string& feedback, ArrowHint hint);
+
+    // LAYAR-LAYAR PERMAINAN (dipanggil setelah screen.beginFrame())
+    void displayMenu();
+    void displayInstructions(const GameCore& core, bool hintKey, bool timed = false);
+    // elapsedMs >= 0: tampilkan waktu; remaining >= 0: jumlah angka yang masih mungkin.
+    // Jika tinggi layar diketahui, tebakan terlama disembunyikan agar papan dan input muat.
+    void displayBoard(const GameCore& core, int64_t elapsedMs = -1, int64_t remaining = -1);
+    void displayGuessInput(const std::string& input, const std::string& hintText, bool hintKey,
+                           bool candidatesKey = false);
+    void displayNotice(const std::string& message);
+    void displayTraceOverlay(const std::string& footer = ""); // p50/p99/maks tiap fase dari symbolic_trace
+    void displayStats(const GameCore& core, bool won, int64_t elapsedMs = -1);
+    void displayLeaderboard(const LeaderboardView& view);
+};
+
+#endif
@@ -0,0 +1,213 @@
+#include "symbolic_book.h"
+#include "symbolic_candidates.h"
+#include "symbolic_fileio.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+constexpr char BOOK_MAGIC[8] = {'S', 'Y', 'M', 'B', 'O', 'O', 'K', '1'};
+constexpr uint32_t BOOK_VERSION = 1;
+constexpr uint32_t FLAG_CANDIDATES_ONLY = 1;
+
+struct BookHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t entrySize;
+    uint32_t scoring;
+    uint32_t flags;
+    uint32_t depth;
+    uint32_t reserved;
+    uint64_t count;
+};
+
+static_assert(sizeof(BookHeader) == 40, "BookHeader harus 40 byte");
+static_assert(sizeof(BookEntry) == 16, "BookEntry harus 16 byte");
+
+/*
+ * KUNCI POSISI
+ * bit 60-63 jumlah digit, bit 58-59 jumlah langkah sebelumnya, lalu 17 bit
+ * per langkah (kode umpan balik basis-3 dan panah) mulai dari bit 57 ke bawah.
+ * Kode umpan balik sampai 9 digit < 3^9 sehingga muat di 15 bit.
+ */
+constexpr int PLY_BITS = 17;
+
+uint64_t rootKey(int digits) {
+    return static_cast<uint64_t>(digits) << 60;
+}
+
+uint64_t childKey(uint64_t key, uint16_t code, ArrowHint hint) {
+    uint64_t ply = (key >> 58) & 3;
+    uint64_t step = (static_cast<uint64_t>(code) << 2) | static_cast<uint64_t>(hint);
+    key += uint64_t(1) << 58;
+    return key | (step << (58 - PLY_BITS * (ply + 1)));
+}
+
+string formatGuess(uint32_t value, int digits) {
+    string text(static_cast<size_t>(digits), '0');
+    for (int i = digits - 1; i >= 0 && value > 0; i--) {
+        text[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return text;
+}
+
+struct BookBuilder {
+    const BookBuildOptions& options;
+    BookBuildStats& stats;
+    const BookProgress& progress;
+    vector<BookEntry> entries;
+
+    // Mencari tebakan untuk posisi ini lalu turun ke setiap hasil yang mungkin
+    void expand(int digits, vector<GuessRecord>& history, uint64_t key) {
+        SolverResult result;
+        if (!solveNextGuess(digits, history, options.solver, result)) return;
+        entries.push_back({key, static_cast<uint32_t>(stoul(result.guess)), static_cast<uint32_t>(result.candidates)});
+        stats.positions++;
+        if (!result.complete) stats.incomplete++;
+        if (progress) progress(digits, stats.positions);
+        if (static_cast<int>(history.size()) + 1 >= options.depth || result.candidates <= 1) return;
+
+        // Kandidat dikelompokkan menurut (umpan balik, panah) yang akan dilihat pemain
+        PackedCandidates candidates;
+        consistentCandidates(digits, history, candidates);
+        vector<uint16_t> codes(candidates.size());
+        scoreGuessBatch(result.guess, candidates, 0, candidates.size(), codes.data());
+        const uint64_t guessValue = stoull(result.guess);
+        const uint16_t winning = winningCode(digits);
+        vector<uint32_t> outcomes;
+        for (size_t i = 0; i < candidates.size(); i++) {
+            if (codes[i] == winning) continue;
+            uint64_t value = candidates.value(i);
+            ArrowHint hint = value > guessValue ? ArrowHint::UP : ArrowHint::DOWN;
+            outcomes.push_back((static_cast<uint32_t>(codes[i]) << 2) | static_cast<uint32_t>(hint));
+        }
+        sort(outcomes.begin(), outcomes.end());
+        outcomes.erase(unique(outcomes.begin(), outcomes.end()), outcomes.end());
+
+        for (uint32_t outcome : outcomes) {
+            uint16_t code = static_cast<uint16_t>(outcome >> 2);
+            ArrowHint hint = static_cast<ArrowHint>(outcome & 3);
+            history.push_back({result.guess, feedbackString(code, digits), hint});
+            expand(digits, history, childKey(key, code, hint));
+            history.pop_back();
+        }
+    }
+};
+
+} // namespace
+
+vector<BookEntry> buildOpeningBook(const BookBuildOptions& options, BookBuildStats& stats, const BookProgress& progress) {
+    auto start = chrono::steady_clock::now();
+    stats = BookBuildStats();
+    BookBuilder builder{options, stats, progress, {}};
+    if (options.depth < 1 || options.depth > MAX_BOOK_DEPTH) return {};
+    for (int digits : options.digits) {
+        if (digits < 1 || digits > CANDIDATE_MAX_DIGITS) continue;
+        vector<GuessRecord> history;
+        builder.expand(digits, history, rootKey(digits));
+    }
+    sort(builder.entries.begin(), builder.entries.end(),
+         [](const BookEntry& a, const BookEntry& b) { return a.key < b.key; });
+    stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return builder.entries;
+}
+
+bool writeOpeningBook(const string& path, const BookBuildOptions& options, const vector<BookEntry>& entries) {
+    string tempPath = path + ".tmp";
+    int fd = openFile(tempPath, false);
+    if (fd < 0) return false;
+
+    BookHeader header = {};
+    memcpy(header.magic, BOOK_MAGIC, sizeof BOOK_MAGIC);
+    header.version = BOOK_VERSION;
+    header.entrySize = sizeof(BookEntry);
+    header.scoring = static_cast<uint32_t>(options.solver.scoring);
+    header.flags = options.solver.candidatesOnly ? FLAG_CANDIDATES_ONLY : 0;
+    header.depth = static_cast<uint32_t>(options.depth);
+    header.count = entries.size();
+    bool ok = writeFile(fd, &header, sizeof header) &&
+              writeFile(fd, entries.data(), entries.size() * sizeof(BookEntry)) && syncFile(fd);
+    closeFile(fd);
+    return ok && replaceFile(tempPath, path);
+}
+
+/*
+ * MEMBACA BUKU
+ */
+bool OpeningBook::open(const string& path) {
+    close();
+    if (!file.open(path) || file.size() < sizeof(BookHeader)) {
+        file.close();
+        return false;
+    }
+    BookHeader header;
+    memcpy(&header, file.data(), sizeof header);
+    bool valid = memcmp(header.magic, BOOK_MAGIC, sizeof BOOK_MAGIC) == 0 && header.version == BOOK_VERSION &&
+                 header.entrySize == sizeof(BookEntry) && header.depth >= 1 && header.depth <= MAX_BOOK_DEPTH &&
+                 header.scoring <= static_cast<uint32_t>(SolverScoring::ENTROPY) && header.count > 0 &&
+                 file.size() == sizeof header + header.count * sizeof(BookEntry);
+    if (!valid) {
+        file.close();
+        return false;
+    }
+    entries = reinterpret_cast<const BookEntry*>(file.data() + sizeof header);
+    count = static_cast<size_t>(header.count);
+    scoring = static_cast<SolverScoring>(header.scoring);
+    candidatesOnly = (header.flags & FLAG_CANDIDATES_ONLY) != 0;
+    depth = static_cast<int>(header.depth);
+    return true;
+}
+
+void OpeningBook::close() {
+    file.close();
+    entries = nullptr;
+    count = 0;
+    depth = 0;
+}
+
+const BookEntry* OpeningBook::find(uint64_t key) const {
+    const BookEntry* end = entries + count;
+    const BookEntry* entry =
+        lower_bound(entries, end, key, [](const BookEntry& item, uint64_t wanted) { return item.key < wanted; });
+    return (entry != end && entry->key == key) ? entry : nullptr;
+}
+
+bool OpeningBook::lookup(int digits, const vector<GuessRecord>& history, const SolverOptions& options,
+                         SolverResult& result) const {
+    if (!isOpen() || options.scoring != scoring || options.candidatesOnly != candidatesOnly) return false;
+    if (digits < 1 || digits > CANDIDATE_MAX_DIGITS || history.size() >= static_cast<size_t>(depth)) return false;
+
+    // Jalur buku diikuti langkah demi langkah; berhenti begitu pemain menebak angka lain
+    uint64_t key = rootKey(digits);
+    for (size_t ply = 0;; ply++) {
+        const BookEntry* entry = find(key);
+        if (!entry) return false;
+        string guess = formatGuess(entry->guess, digits);
+        if (ply == history.size()) {
+            result = SolverResult();
+            result.guess = guess;
+            result.candidates = entry->candidates;
+            result.complete = true;
+            result.fromBook = true;
+            return true;
+        }
+        const GuessRecord& step = history[ply];
+        if (step.guess != guess || step.hint == ArrowHint::NONE) return false;
+        key = childKey(key, feedbackCode(step.result), step.hint);
+    }
+}
+
+bool solveNextGuess(const OpeningBook& book, int digits, const vector<GuessRecord>& history,
+                    const SolverOptions& options, SolverResult& result) {
+    auto start = chrono::steady_clock::now();
+    if (book.lookup(digits, history, options, result)) {
+        result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        return true;
+    }
+    return solveNextGuess(digits, history, options, result);
+}
@@ -0,0 +1,89 @@
+/*
+ * SYMBOLIC NUMBLER - BUKU PEMBUKAAN
+ *
+ * Tebakan terbaik untuk beberapa langkah pertama selalu sama di setiap
+ * permainan, jadi dihitung sekali oleh symbolic_book lalu disimpan sebagai
+ * file biner berisi entri terurut. Kunci sebuah posisi adalah jumlah digit
+ * ditambah umpan balik dan panah dari setiap langkah sebelumnya; tebakannya
+ * sendiri tidak perlu ikut karena selalu tebakan dari buku.
+ *
+ * File dipetakan dengan mmap dan dicari dengan pencarian biner, jadi membuka
+ * buku hampir tanpa biaya dan satu kueri O(kedalaman × log n). Di luar buku
+ * (lebih dalam, atau pemain menebak angka lain) pencarian langsung dipakai.
+ */
+#ifndef SYMBOLIC_BOOK_H
+#define SYMBOLIC_BOOK_H
+
+#include "symbolic_mmap.h"
+#include "symbolic_solver.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Langkah terdalam yang masih bisa dikodekan di kunci 64-bit
+constexpr int MAX_BOOK_DEPTH = 3;
+
+// Satu posisi di file buku (16 byte, diurutkan menurut key)
+struct BookEntry {
+    uint64_t key;
+    uint32_t guess;      // Tebakan sebagai angka (nol di depan tidak disimpan)
+    uint32_t candidates; // Angka yang masih mungkin di posisi ini
+};
+
+struct BookBuildOptions {
+    std::vector<int> digits = {3, 4, 5, 6}; // Preset menu; kustom 1..CANDIDATE_MAX_DIGITS juga boleh
+    int depth = 2;                          // Jumlah tebakan per jalur (1..MAX_BOOK_DEPTH)
+    SolverOptions solver;
+};
+
+struct BookBuildStats {
+    size_t positions = 0;
+    size_t incomplete = 0; // Posisi yang pencariannya terpotong batas waktu
+    double seconds = 0.0;
+};
+
+// Dipanggil setelah setiap posisi selesai dicari
+using BookProgress = std::function<void(int digits, size_t positions)>;
+
+// Mencari semua posisi buku; entri dikembalikan sudah terurut
+std::vector<BookEntry> buildOpeningBook(const BookBuildOptions& options, BookBuildStats& stats,
+                                        const BookProgress& progress = nullptr);
+
+// Menulis ke file sementara lalu mengganti path secara atomik
+bool writeOpeningBook(const std::string& path, const BookBuildOptions& options, const std::vector<BookEntry>& entries);
+
+class OpeningBook {
+private:
+    MappedFile file;
+    const BookEntry* entries = nullptr;
+    size_t count = 0;
+    SolverScoring scoring = SolverScoring::MINIMAX;
+    bool candidatesOnly = false;
+    int depth = 0;
+
+    const BookEntry* find(uint64_t key) const;
+
+public:
+    // false jika file tidak ada atau bukan buku yang sah (buku lama ditutup)
+    bool open(const std::string& path);
+    void close();
+
+    // Tebakan buku untuk riwayat ini; false jika riwayat sudah keluar dari buku
+    // atau buku dibuat dengan metrik lain
+    bool lookup(int digits, const std::vector<GuessRecord>& history, const SolverOptions& options,
+                SolverResult& result) const;
+
+    bool isOpen() const { return entries != nullptr; }
+    size_t size() const { return count; }
+    int getDepth() const { return depth; }
+    SolverScoring getScoring() const { return scoring; }
+};
+
+// Tebakan dari buku bila ada, selain itu pencarian langsung seperti biasa
+bool solveNextGuess(const OpeningBook& book, int digits, const std::vector<GuessRecord>& history,
+                    const SolverOptions& options, SolverResult& result);
+
+#endif
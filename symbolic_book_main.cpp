@@ -0,0 +1,117 @@
+/*
+ * SYMBOLIC NUMBLER - PEMBUAT BUKU PEMBUKAAN
+ *
+ * Mencari tebakan terbaik untuk setiap posisi di beberapa langkah pertama
+ * lalu menulisnya ke file buku yang dibaca game (petunjuk H) dan
+ * symbolic_solve --book. Contoh:
+ *   symbolic_book --digits 3,4,5,6 --depth 2 --out symbolic_book.bin
+ *   symbolic_book --digits 4 --depth 3 --scoring entropy --out entropy.bin
+ */
+#include "symbolic_book.h"
+#include "symbolic_candidates.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " [opsi]\n"
+         << "  --out FILE          File buku (bawaan: symbolic_book.bin)\n"
+         << "  --digits A,B,...    Jumlah digit yang dicakup, masing-masing 1-" << CANDIDATE_MAX_DIGITS
+         << " (bawaan: 3,4,5,6)\n"
+         << "  --depth N           Tebakan per jalur, 1-" << MAX_BOOK_DEPTH << " (bawaan: 2)\n"
+         << "  --scoring S         minimax | expected | entropy (bawaan: minimax)\n"
+         << "  --budget-ms N       Batas waktu pencarian per posisi (bawaan: 60000)\n"
+         << "  --threads N         Jumlah thread (bawaan: semua inti)\n"
+         << "  --candidates-only   Hanya menebak angka yang masih mungkin\n";
+}
+
+bool parseDigits(const char* text, vector<int>& digits) {
+    digits.clear();
+    while (*text) {
+        char* end = nullptr;
+        long value = strtol(text, &end, 10);
+        if (end == text || value < 1 || value > CANDIDATE_MAX_DIGITS) return false;
+        digits.push_back(static_cast<int>(value));
+        text = (*end == ',') ? end + 1 : end;
+        if (*end != ',' && *end != '\0') return false;
+    }
+    return !digits.empty();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    string outPath = "symbolic_book.bin";
+    BookBuildOptions options;
+    options.solver.budgetMs = 60000; // Dihitung sekali, jadi boleh jauh lebih lama dari petunjuk
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--out") == 0 && hasValue) outPath = argv[++i];
+        else if (strcmp(arg, "--digits") == 0 && hasValue) {
+            if (!parseDigits(argv[++i], options.digits)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(arg, "--depth") == 0 && hasValue) options.depth = atoi(argv[++i]);
+        else if (strcmp(arg, "--scoring") == 0 && hasValue) {
+            if (!parseScoring(argv[++i], options.solver.scoring)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(arg, "--budget-ms") == 0 && hasValue) options.solver.budgetMs = atoi(argv[++i]);
+        else if (strcmp(arg, "--threads") == 0 && hasValue) options.solver.threads = static_cast<unsigned>(atoi(argv[++i]));
+        else if (strcmp(arg, "--candidates-only") == 0) options.solver.candidatesOnly = true;
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (options.depth < 1 || options.depth > MAX_BOOK_DEPTH) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    BookBuildStats stats;
+    vector<BookEntry> entries = buildOpeningBook(options, stats, [](int digits, size_t positions) {
+        if (positions % 100 == 0) cerr << "\r" << digits << " digit: " << positions << " posisi" << flush;
+    });
+    if (stats.positions >= 100) cerr << "\n";
+    if (entries.empty()) {
+        cerr << "Tidak ada posisi yang bisa dicari.\n";
+        return 1;
+    }
+    if (!writeOpeningBook(outPath, options, entries)) {
+        cerr << "Gagal menulis " << outPath << "\n";
+        return 1;
+    }
+
+    cout << stats.positions << " posisi (" << scoringName(options.solver.scoring) << ", kedalaman " << options.depth
+         << ") ditulis ke " << outPath << " dalam " << fixed << setprecision(1) << stats.seconds << " detik\n";
+    if (stats.incomplete > 0) {
+        cout << stats.incomplete << " posisi terpotong batas waktu; naikkan --budget-ms untuk hasil penuh\n";
+    }
+
+    // Tebakan pertama setiap jumlah digit langsung dari file yang baru ditulis
+    OpeningBook book;
+    if (!book.open(outPath)) {
+        cerr << "File yang baru ditulis tidak bisa dibaca: " << outPath << "\n";
+        return 1;
+    }
+    for (int digits : options.digits) {
+        SolverResult first;
+        if (book.lookup(digits, {}, options.solver, first)) {
+            cout << "  " << digits << " digit: " << first.guess << " (" << first.candidates << " kemungkinan)\n";
+        }
+    }
+    return 0;
+}
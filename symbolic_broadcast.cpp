@@ -0,0 +1,408 @@
+#include "symbolic_broadcast.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+using namespace std;
+
+/*
+ * TATA LETAK FILE SIARAN
+ * Header (satu baris cache untuk nomor frame terbaru dan jumlah penonton
+ * yang tidur), tabel penonton (satu baris cache per penonton), lalu slot
+ * frame. Semua ukuran tetap, jadi file dibuat sekali dengan ukuran penuh.
+ */
+namespace {
+
+constexpr char BROADCAST_MAGIC[8] = {'S', 'Y', 'M', 'C', 'A', 'S', 'T', '1'};
+constexpr uint32_t BROADCAST_VERSION = 1;
+
+enum : uint32_t { STATE_LIVE = 1, STATE_ENDED = 2 };
+
+static_assert(atomic<uint64_t>::is_always_lock_free && atomic<uint32_t>::is_always_lock_free,
+              "Atomik di memori bersama harus bebas kunci");
+static_assert(is_trivially_copyable_v<ScreenCell> && sizeof(ScreenCell) == 2, "ScreenCell disalin apa adanya");
+
+struct alignas(64) ViewerSlot {
+    atomic<uint32_t> pid;
+    atomic<uint64_t> lastFrame;
+    atomic<uint64_t> shown;
+    atomic<uint64_t> skipped;
+    atomic<uint64_t> retries;
+    atomic<uint64_t> lastLagNs;
+    atomic<uint64_t> maxLagNs;
+    atomic<uint64_t> totalLagNs;
+};
+
+struct alignas(64) FrameSlot {
+    atomic<uint64_t> seq; // Ganjil selama penulis menulis slot ini
+    uint64_t frame;
+    int64_t publishedNs;  // steady_clock, sama untuk semua proses di mesin ini
+    uint32_t rows;
+    uint32_t cells;
+    uint32_t widths[BROADCAST_MAX_ROWS];
+    ScreenCell data[BROADCAST_MAX_CELLS];
+};
+
+int64_t nowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#ifndef _WIN32
+bool processAlive(uint32_t pid) {
+    return pid != 0 && (kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH);
+}
+
+uint64_t inodeOf(const string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 ? static_cast<uint64_t>(info.st_ino) : 0;
+}
+#endif
+
+} // namespace
+
+struct BroadcastArea {
+    char magic[8];
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t maxRows;
+    uint32_t maxCells;
+    uint32_t maxViewers;
+    uint32_t publisherPid;
+
+    alignas(64) atomic<uint64_t> latest;   // Nomor frame utuh terbaru (0 = belum ada)
+    atomic<uint32_t> wakeWord;             // Bit bawah latest, kata futex penonton
+    atomic<uint32_t> sleepers;             // Penonton yang sedang tidur di wakeWord
+    atomic<uint32_t> state;
+    atomic<uint64_t> truncated;
+
+    ViewerSlot viewers[BROADCAST_MAX_VIEWERS];
+    FrameSlot slots[BROADCAST_SLOTS];
+};
+
+namespace {
+
+void wakeViewers(BroadcastArea* area) {
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&area->wakeWord), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+    (void)area;
+#endif
+}
+
+BroadcastStats readStats(const BroadcastArea* area) {
+    BroadcastStats result;
+    if (!area) return result;
+    result.published = area->latest.load(memory_order_acquire);
+    result.truncated = area->truncated.load(memory_order_relaxed);
+#ifndef _WIN32
+    result.live = area->state.load(memory_order_acquire) == STATE_LIVE && processAlive(area->publisherPid);
+    for (const ViewerSlot& slot : area->viewers) {
+        uint32_t pid = slot.pid.load(memory_order_acquire);
+        if (!processAlive(pid)) continue;
+        ViewerStats viewer;
+        viewer.pid = static_cast<int>(pid);
+        viewer.lastFrame = slot.lastFrame.load(memory_order_relaxed);
+        viewer.shown = slot.shown.load(memory_order_relaxed);
+        viewer.skipped = slot.skipped.load(memory_order_relaxed);
+        viewer.retries = slot.retries.load(memory_order_relaxed);
+        viewer.lastLagNs = slot.lastLagNs.load(memory_order_relaxed);
+        viewer.maxLagNs = slot.maxLagNs.load(memory_order_relaxed);
+        viewer.totalLagNs = slot.totalLagNs.load(memory_order_relaxed);
+        result.viewers.push_back(viewer);
+    }
+#endif
+    return result;
+}
+
+} // namespace
+
+string defaultBroadcastPath() {
+#ifdef __linux__
+    struct stat info;
+    if (stat("/dev/shm", &info) == 0 && S_ISDIR(info.st_mode)) return "/dev/shm/symbolic_broadcast";
+#endif
+    return "symbolic_broadcast.shm";
+}
+
+/*
+ * PEMAIN
+ */
+bool BroadcastPublisher::open(const string& filePath) {
+    close();
+#ifdef _WIN32
+    (void)filePath;
+    return false;
+#else
+    // File baru dipasang dengan rename agar penonton tidak pernah melihat header setengah jadi
+    string tempPath = filePath + ".tmp";
+    int fd = ::open(tempPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    if (ftruncate(fd, sizeof(BroadcastArea)) < 0) {
+        ::close(fd);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    void* address = mmap(nullptr, sizeof(BroadcastArea), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        unlink(tempPath.c_str());
+        return false;
+    }
+
+    // File baru berisi nol: semua atomik, seqlock dan tabel penonton sudah dalam keadaan awal
+    area = static_cast<BroadcastArea*>(address);
+    area->version = BROADCAST_VERSION;
+    area->slotCount = BROADCAST_SLOTS;
+    area->maxRows = BROADCAST_MAX_ROWS;
+    area->maxCells = BROADCAST_MAX_CELLS;
+    area->maxViewers = BROADCAST_MAX_VIEWERS;
+    area->publisherPid = static_cast<uint32_t>(getpid());
+    area->state.store(STATE_LIVE, memory_order_relaxed);
+    memcpy(area->magic, BROADCAST_MAGIC, sizeof BROADCAST_MAGIC);
+    if (rename(tempPath.c_str(), filePath.c_str()) < 0) {
+        munmap(area, sizeof(BroadcastArea));
+        area = nullptr;
+        unlink(tempPath.c_str());
+        return false;
+    }
+    path = filePath;
+    frameSeq = 0;
+    return true;
+#endif
+}
+
+void BroadcastPublisher::close() {
+    if (!area) return;
+#ifndef _WIN32
+    area->state.store(STATE_ENDED, memory_order_release);
+    area->wakeWord.fetch_add(1, memory_order_release);
+    wakeViewers(area);
+    munmap(area, sizeof(BroadcastArea));
+#endif
+    area = nullptr;
+}
+
+void BroadcastPublisher::publish(const ScreenBuffer& screen) {
+    if (!area) return;
+    lock_guard<std::mutex> lock(mutex);
+    uint64_t frame = ++frameSeq;
+    FrameSlot& slot = area->slots[frame % BROADCAST_SLOTS];
+
+    // Seqlock: nomor ganjil dulu, lalu isi slot, lalu nomor genap berikutnya
+    uint64_t seq = slot.seq.load(memory_order_relaxed);
+    slot.seq.store(seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    size_t rows = min(screen.getRowCount(), BROADCAST_MAX_ROWS);
+    size_t used = 0;
+    bool truncated = rows < screen.getRowCount();
+    for (size_t r = 0; r < rows; r++) {
+        const vector<ScreenCell>& cells = screen.getLine(r).getCells();
+        size_t width = min(cells.size(), BROADCAST_MAX_CELLS - used);
+        if (width < cells.size()) truncated = true;
+        memcpy(slot.data + used, cells.data(), width * sizeof(ScreenCell));
+        slot.widths[r] = static_cast<uint32_t>(width);
+        used += width;
+    }
+    slot.frame = frame;
+    slot.publishedNs = nowNs();
+    slot.rows = static_cast<uint32_t>(rows);
+    slot.cells = static_cast<uint32_t>(used);
+    slot.seq.store(seq + 2, memory_order_release);
+    if (truncated) area->truncated.fetch_add(1, memory_order_relaxed);
+
+    area->latest.store(frame, memory_order_release);
+    area->wakeWord.store(static_cast<uint32_t>(frame), memory_order_release);
+    // Dekker dengan BroadcastViewer::wait: tulis wakeWord lalu baca sleepers
+    atomic_thread_fence(memory_order_seq_cst);
+    if (area->sleepers.load(memory_order_relaxed) > 0) wakeViewers(area);
+}
+
+BroadcastStats BroadcastPublisher::stats() const {
+    return readStats(area);
+}
+
+/*
+ * PENONTON
+ */
+bool BroadcastViewer::open(const string& filePath, bool registerViewer) {
+    close();
+#ifdef _WIN32
+    (void)filePath;
+    (void)registerViewer;
+    return false;
+#else
+    int fd = ::open(filePath.c_str(), O_RDWR);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) < 0 || static_cast<size_t>(info.st_size) != sizeof(BroadcastArea)) {
+        ::close(fd);
+        return false;
+    }
+    void* address = mmap(nullptr, sizeof(BroadcastArea), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) return false;
+    BroadcastArea* mapped = static_cast<BroadcastArea*>(address);
+    if (memcmp(mapped->magic, BROADCAST_MAGIC, sizeof BROADCAST_MAGIC) != 0 || mapped->version != BROADCAST_VERSION ||
+        mapped->slotCount != BROADCAST_SLOTS || mapped->maxRows != BROADCAST_MAX_ROWS ||
+        mapped->maxCells != BROADCAST_MAX_CELLS || mapped->maxViewers != BROADCAST_MAX_VIEWERS) {
+        munmap(address, sizeof(BroadcastArea));
+        return false;
+    }
+    // Penonton hanya bergabung ke siaran yang masih berjalan
+    if (registerViewer &&
+        (mapped->state.load(memory_order_acquire) != STATE_LIVE || !processAlive(mapped->publisherPid))) {
+        munmap(address, sizeof(BroadcastArea));
+        return false;
+    }
+    area = mapped;
+    path = filePath;
+    fileId = static_cast<uint64_t>(info.st_ino);
+    lastFrame = 0;
+    own = ViewerStats();
+    own.pid = static_cast<int>(getpid());
+    if (!registerViewer) return true;
+
+    // Baris kosong, atau baris penonton yang prosesnya sudah mati
+    for (size_t i = 0; i < BROADCAST_MAX_VIEWERS; i++) {
+        ViewerSlot& slot = area->viewers[i];
+        uint32_t current = slot.pid.load(memory_order_acquire);
+        if (current != 0 && processAlive(current)) continue;
+        if (!slot.pid.compare_exchange_strong(current, static_cast<uint32_t>(own.pid), memory_order_acq_rel)) continue;
+        viewerIndex = i;
+        storeStats();
+        break;
+    }
+    // Tabel penuh: tetap bisa menonton, hanya tidak terlihat di statistik
+    return true;
+#endif
+}
+
+void BroadcastViewer::close() {
+    if (!area) return;
+#ifndef _WIN32
+    if (viewerIndex != SIZE_MAX) area->viewers[viewerIndex].pid.store(0, memory_order_release);
+    munmap(area, sizeof(BroadcastArea));
+#endif
+    area = nullptr;
+    viewerIndex = SIZE_MAX;
+    own = ViewerStats();
+}
+
+uint64_t BroadcastViewer::latestFrame() const {
+    return area ? area->latest.load(memory_order_acquire) : 0;
+}
+
+BroadcastStats BroadcastViewer::stats() const {
+    return readStats(area);
+}
+
+BroadcastViewer::Wait BroadcastViewer::wait(chrono::milliseconds timeout) {
+    if (!area) return Wait::ENDED;
+#ifndef _WIN32
+    if (latestFrame() != lastFrame) return Wait::FRAME;
+    if (area->state.load(memory_order_acquire) == STATE_LIVE) {
+#ifdef __linux__
+        area->sleepers.fetch_add(1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        uint32_t word = area->wakeWord.load(memory_order_acquire);
+        if (latestFrame() == lastFrame && area->state.load(memory_order_acquire) == STATE_LIVE) {
+            struct timespec limit;
+            limit.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+            limit.tv_nsec = static_cast<long>(timeout.count() % 1000) * 1000000;
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&area->wakeWord), FUTEX_WAIT, word, &limit, nullptr, 0);
+        }
+        area->sleepers.fetch_sub(1, memory_order_relaxed);
+#else
+        this_thread::sleep_for(min(timeout, chrono::milliseconds(2)));
+#endif
+    }
+    if (latestFrame() != lastFrame) return Wait::FRAME;
+
+    // Pemain keluar tanpa sempat menandai (crash) atau sudah ada siaran baru di path yang sama
+    if (area->state.load(memory_order_acquire) != STATE_LIVE || !processAlive(area->publisherPid) ||
+        inodeOf(path) != fileId) {
+        return Wait::ENDED;
+    }
+#else
+    (void)timeout;
+#endif
+    return Wait::TIMEOUT;
+}
+
+bool BroadcastViewer::read(ScreenBuffer& screen) {
+    if (!area) return false;
+    while (true) {
+        uint64_t latest = latestFrame();
+        if (latest == 0 || latest == lastFrame) return false;
+        const FrameSlot& slot = area->slots[latest % BROADCAST_SLOTS];
+        uint64_t seq = slot.seq.load(memory_order_acquire);
+        if ((seq & 1) != 0 || slot.frame != latest) {
+            // Penulis sudah memutari cincin sampai slot ini; ambil frame terbaru lagi
+            own.retries++;
+            continue;
+        }
+
+        // Ukuran dibatasi lagi: isi slot baru sah setelah seqlock diperiksa
+        screen.beginFrame();
+        size_t rows = min<size_t>(slot.rows, BROADCAST_MAX_ROWS);
+        size_t used = 0;
+        for (size_t r = 0; r < rows; r++) {
+            size_t width = min<size_t>(slot.widths[r], BROADCAST_MAX_CELLS - used);
+            screen.newLine().appendCells(slot.data + used, width);
+            used += width;
+        }
+        int64_t publishedNs = slot.publishedNs;
+        atomic_thread_fence(memory_order_acquire);
+        if (slot.seq.load(memory_order_relaxed) != seq) {
+            own.retries++;
+            continue;
+        }
+
+        if (lastFrame != 0) own.skipped += latest - lastFrame - 1;
+        lastFrame = latest;
+        pendingPublishedNs = publishedNs;
+        return true;
+    }
+}
+
+void BroadcastViewer::shown() {
+    uint64_t lag = static_cast<uint64_t>(max<int64_t>(0, nowNs() - pendingPublishedNs));
+    own.lastFrame = lastFrame;
+    own.shown++;
+    own.lastLagNs = lag;
+    own.maxLagNs = max(own.maxLagNs, lag);
+    own.totalLagNs += lag;
+    storeStats();
+}
+
+void BroadcastViewer::storeStats() {
+    if (!area || viewerIndex == SIZE_MAX) return;
+    ViewerSlot& slot = area->viewers[viewerIndex];
+    slot.lastFrame.store(own.lastFrame, memory_order_relaxed);
+    slot.shown.store(own.shown, memory_order_relaxed);
+    slot.skipped.store(own.skipped, memory_order_relaxed);
+    slot.retries.store(own.retries, memory_order_relaxed);
+    slot.lastLagNs.store(own.lastLagNs, memory_order_relaxed);
+    slot.maxLagNs.store(own.maxLagNs, memory_order_relaxed);
+    slot.totalLagNs.store(own.totalLagNs, memory_order_relaxed);
+}
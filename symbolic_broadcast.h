@@ -0,0 +1,150 @@
+/*
+ * SYMBOLIC NUMBLER - SIARAN FRAME KE PENONTON LEWAT MEMORI BERSAMA
+ *
+ * Proses pemain menulis setiap frame (sel layar, bukan byte escape) satu
+ * kali ke cincin slot di file yang dipetakan MAP_SHARED. Penonton
+ * (symbolic_watch) memetakan file yang sama dan membaca sel langsung dari
+ * halaman bersama, jadi biaya pemain tetap satu salinan per frame berapa
+ * pun jumlah penontonnya, dan pemain tidak pernah menunggu penonton.
+ *
+ * Setiap slot dilindungi seqlock: penulis menandai nomor ganjil selama
+ * menulis, pembaca mengulang jika nomor berubah di tengah salinan. Penonton
+ * selalu mengambil frame terbaru; frame di antaranya dilewati (tidak ada
+ * tekanan balik), dan karena setiap slot berisi frame utuh penonton bisa
+ * melompat ke mana saja lalu menghitung diff terhadap terminalnya sendiri.
+ *
+ * Setiap penonton mengisi satu baris di tabel penonton di header yang sama
+ * (frame tampil, frame dilewati, jeda publish-sampai-tampil), sehingga
+ * pemain dan symbolic_watch --stats bisa melihat seberapa jauh penonton
+ * tertinggal. Di Linux penonton tidur di futex sampai frame berikutnya;
+ * di POSIX lain memakai jeda pendek. Windows tidak didukung.
+ */
+#ifndef SYMBOLIC_BROADCAST_H
+#define SYMBOLIC_BROADCAST_H
+
+#include "symbolic_screen.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct BroadcastArea; // Tata letak di memori bersama (symbolic_broadcast.cpp)
+
+// Ukuran tetap file siaran
+constexpr size_t BROADCAST_SLOTS = 8;           // Frame terbaru yang masih bisa dibaca
+constexpr size_t BROADCAST_MAX_ROWS = 512;
+constexpr size_t BROADCAST_MAX_CELLS = 65536;    // Per frame; sisanya dipotong
+constexpr size_t BROADCAST_MAX_VIEWERS = 64;
+
+// /dev/shm/symbolic_broadcast di Linux, selain itu symbolic_broadcast.shm di folder kerja
+std::string defaultBroadcastPath();
+
+// Statistik satu penonton (ditulis penonton, dibaca siapa saja)
+struct ViewerStats {
+    int pid = 0;
+    uint64_t lastFrame = 0;  // Nomor frame terakhir yang tampil
+    uint64_t shown = 0;      // Frame yang ditulis ke terminal penonton
+    uint64_t skipped = 0;    // Frame yang dilewati karena sudah ada yang lebih baru
+    uint64_t retries = 0;    // Salinan yang diulang karena slotnya sedang ditimpa
+    uint64_t lastLagNs = 0;  // Publish sampai tampil, frame terakhir
+    uint64_t maxLagNs = 0;
+    uint64_t totalLagNs = 0;
+
+    uint64_t meanLagNs() const { return shown ? totalLagNs / shown : 0; }
+};
+
+struct BroadcastStats {
+    uint64_t published = 0;  // Frame yang ditulis pemain
+    uint64_t truncated = 0;  // Frame yang tidak muat di slot dan dipotong
+    bool live = false;       // Pemain masih menyiarkan
+    std::vector<ViewerStats> viewers;
+};
+
+/*
+ * PEMAIN (PENULIS)
+ * publish() dipanggil ScreenBuffer setiap kali frame disusun; aman dari
+ * beberapa thread (layar utama dan thread render) lewat kunci tanpa
+ * persaingan. Tidak mengalokasikan memori dan tidak memanggil sistem
+ * kecuali ada penonton yang sedang tidur menunggu frame.
+ */
+class BroadcastPublisher {
+private:
+    std::string path;
+    BroadcastArea* area = nullptr;
+    std::mutex mutex;
+    uint64_t frameSeq = 0;
+
+public:
+    BroadcastPublisher() = default;
+    ~BroadcastPublisher() { close(); }
+    BroadcastPublisher(const BroadcastPublisher&) = delete;
+    BroadcastPublisher& operator=(const BroadcastPublisher&) = delete;
+
+    // Membuat file siaran baru (file lama diganti; penonton lama pindah sendiri)
+    bool open(const std::string& filePath);
+    // Menandai siaran selesai lalu melepas pemetaan; file dibiarkan untuk --stats
+    void close();
+
+    void publish(const ScreenBuffer& screen);
+
+    bool isOpen() const { return area != nullptr; }
+    const std::string& getPath() const { return path; }
+    BroadcastStats stats() const;
+};
+
+/*
+ * PENONTON (PEMBACA)
+ */
+class BroadcastViewer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Wait {
+        FRAME,   // Ada frame yang lebih baru dari yang terakhir tampil
+        TIMEOUT,
+        ENDED    // Pemain berhenti menyiarkan (atau file diganti siaran baru)
+    };
+
+private:
+    std::string path;
+    BroadcastArea* area = nullptr;
+    size_t viewerIndex = SIZE_MAX; // Baris di tabel penonton; SIZE_MAX = hanya membaca statistik
+    uint64_t lastFrame = 0;
+    uint64_t fileId = 0;           // Inode file yang dipetakan, untuk mengenali siaran baru
+    int64_t pendingPublishedNs = 0;
+    ViewerStats own;
+
+    void storeStats();
+
+public:
+    BroadcastViewer() = default;
+    ~BroadcastViewer() { close(); }
+    BroadcastViewer(const BroadcastViewer&) = delete;
+    BroadcastViewer& operator=(const BroadcastViewer&) = delete;
+
+    // false jika tidak ada siaran yang berjalan di path.
+    // registerViewer = false: hanya membaca statistik (siaran yang sudah selesai juga boleh)
+    bool open(const std::string& filePath, bool registerViewer = true);
+    void close(); // Statistik ownStats() ikut dikosongkan
+
+    // Menunggu frame baru paling lama timeout
+    Wait wait(std::chrono::milliseconds timeout);
+
+    // Menyalin frame terbaru ke screen (beginFrame + satu baris per baris frame).
+    // false jika belum ada frame baru sejak read() terakhir.
+    bool read(ScreenBuffer& screen);
+
+    // Dipanggil setelah frame hasil read() selesai ditulis ke terminal: mencatat jeda
+    void shown();
+
+    bool isOpen() const { return area != nullptr; }
+    const std::string& getPath() const { return path; }
+    uint64_t latestFrame() const;
+    BroadcastStats stats() const;
+    const ViewerStats& ownStats() const { return own; }
+};
+
+#endif
@@ -0,0 +1,159 @@
+/*
+ * SYMBOLIC NUMBLER - KALIBRATOR TINGKAT KESULITAN
+ *
+ * Contoh (6 digit dibagi ke 4 proses, masing-masing semua inti):
+ *   for i in 0 1 2 3; do symbolic_calibrate run --digits 6 --shard $i/4 & done; wait
+ *   symbolic_calibrate merge --out symbolic_difficulty.txt calib_6d_*.ckpt calib_4d_*.ckpt
+ *
+ * Proses yang dihentikan dilanjutkan dengan perintah run yang sama.
+ */
+#include "symbolic_calibration.h"
+#include "symbolic_strategy.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+struct Options {
+    string command;
+    CalibrationConfig config;
+    CalibrationShard shard;
+    unsigned threads = 0;
+    string checkpointPath; // Kosong = calib_<d>d_<i>of<n>.ckpt
+    string outPath = "symbolic_difficulty.txt";
+    vector<string> inputs;
+};
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " <perintah> [opsi]\n"
+         << "Perintah:\n"
+         << "  run             Memainkan setiap angka rahasia di satu shard, dengan checkpoint\n"
+         << "  merge FILE...   Menggabungkan checkpoint semua shard menjadi tabel pengali skor\n"
+         << "Opsi run:\n"
+         << "  --digits N          Jumlah digit, 1-9 (bawaan: 4)\n"
+         << "  --max-attempts N    Batas percobaan per permainan (bawaan: 10)\n"
+         << "  --shard I/N         Shard ke-I dari N, mulai dari 0 (bawaan: 0/1)\n"
+         << "  --threads N         Jumlah thread (bawaan: semua inti)\n"
+         << "  --strategy S        Strategi acuan:";
+    for (const auto& name : strategyNames()) cout << " " << name;
+    cout << " (bawaan: consistent)\n"
+         << "  --seed N            Benih tebakan acak strategi (bawaan: 1)\n"
+         << "  --chunk N           Angka rahasia per potongan (bawaan: 10000)\n"
+         << "  --checkpoint F      File checkpoint (bawaan: calib_<d>d_<i>of<n>.ckpt)\n"
+         << "Opsi merge:\n"
+         << "  --out F             Tabel pengali (bawaan: symbolic_difficulty.txt)\n";
+}
+
+bool parseShard(const char* text, CalibrationShard& shard) {
+    unsigned index = 0, count = 0;
+    if (sscanf(text, "%u/%u", &index, &count) != 2 || count == 0 || index >= count) return false;
+    shard.index = index;
+    shard.count = count;
+    return true;
+}
+
+/*
+ * RUN
+ */
+int runShard(Options& options) {
+    if (options.checkpointPath.empty()) {
+        options.checkpointPath = "calib_" + to_string(options.config.digits) + "d_" + to_string(options.shard.index) +
+                                 "of" + to_string(options.shard.count) + ".ckpt";
+    }
+    CalibrationCheckpoint checkpoint;
+    string error;
+    if (!checkpoint.open(options.checkpointPath, options.config, options.shard, error)) {
+        cerr << error << "\n";
+        return 1;
+    }
+    size_t resumed = checkpoint.getChunks().size();
+    if (resumed > 0) cerr << "Melanjutkan " << options.checkpointPath << ": " << resumed << " potongan sudah selesai\n";
+
+    auto start = chrono::steady_clock::now();
+    bool ok = runCalibrationShard(checkpoint, options.threads, [&](size_t done, size_t total) {
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cerr << "\r" << options.config.digits << " digit, shard " << options.shard.index << "/" << options.shard.count
+             << ": " << done << "/" << total << " potongan, " << fixed << setprecision(0) << seconds << " detik"
+             << flush;
+    }, error);
+    cerr << "\n";
+    if (!ok) {
+        cerr << error << "\n";
+        return 1;
+    }
+    cout << "Shard selesai: " << options.checkpointPath << "\n";
+    return 0;
+}
+
+/*
+ * MERGE
+ */
+int runMerge(const Options& options) {
+    vector<DifficultyRow> rows;
+    string error;
+    if (!mergeCalibration(options.inputs, rows, error)) {
+        cerr << error << "\n";
+        return 1;
+    }
+    if (!writeDifficultyTable(options.outPath, rows)) {
+        cerr << "Gagal menulis " << options.outPath << "\n";
+        return 1;
+    }
+    cout << setw(6) << "Digit" << "  " << setw(9) << "Percobaan" << "  " << setw(9) << "Menang" << "  " << setw(10)
+         << "Rata-rata" << "  " << setw(7) << "Pengali" << "\n";
+    for (const DifficultyRow& row : rows) {
+        cout << setw(6) << row.digits << "  " << setw(9) << row.attempts << "  " << setw(8) << fixed
+             << setprecision(2) << row.winRate() * 100.0 << "%  " << setw(10) << row.expectedAttempts << "  "
+             << setw(7) << row.multiplier << "\n";
+    }
+    cout << rows.size() << " baris ditulis ke " << options.outPath << "\n";
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    options.command = argv[1];
+
+    for (int i = 2; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--digits") == 0 && hasValue) options.config.digits = atoi(argv[++i]);
+        else if (strcmp(arg, "--max-attempts") == 0 && hasValue) options.config.maxAttempts = atoi(argv[++i]);
+        else if (strcmp(arg, "--shard") == 0 && hasValue) {
+            if (!parseShard(argv[++i], options.shard)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(arg, "--threads") == 0 && hasValue) options.threads = static_cast<unsigned>(atoi(argv[++i]));
+        else if (strcmp(arg, "--strategy") == 0 && hasValue) options.config.strategy = argv[++i];
+        else if (strcmp(arg, "--seed") == 0 && hasValue) options.config.seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--chunk") == 0 && hasValue) options.config.chunkSize = static_cast<uint32_t>(atoi(argv[++i]));
+        else if (strcmp(arg, "--checkpoint") == 0 && hasValue) options.checkpointPath = argv[++i];
+        else if (strcmp(arg, "--out") == 0 && hasValue) options.outPath = argv[++i];
+        else if (arg[0] != '-' && options.command == "merge") options.inputs.push_back(arg);
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (options.command == "run") return runShard(options);
+    if (options.command == "merge" && !options.inputs.empty()) return runMerge(options);
+    printUsage(argv[0]);
+    return 1;
+}
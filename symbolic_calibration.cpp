@@ -0,0 +1,408 @@
+#include "symbolic_calibration.h"
+#include "symbolic_core.h"
+#include "symbolic_crc32.h"
+#include "symbolic_fileio.h"
+#include "symbolic_mmap.h"
+#include "symbolic_random.h"
+#include "symbolic_strategy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+constexpr char CHECKPOINT_MAGIC[8] = {'S', 'Y', 'M', 'C', 'A', 'L', '0', '1'};
+constexpr uint32_t CHECKPOINT_VERSION = 1;
+constexpr size_t STRATEGY_NAME_SIZE = 32;
+
+struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t digits;
+    uint32_t maxAttempts;
+    uint32_t chunkSize;
+    uint32_t shardIndex;
+    uint32_t shardCount;
+    uint32_t reserved;
+    uint64_t seed;
+    char strategy[STRATEGY_NAME_SIZE];
+};
+
+// Setiap rekaman: indeks potongan, CRC-32 histogram, lalu histogram
+struct RecordHeader {
+    uint32_t index;
+    uint32_t checksum;
+};
+
+static_assert(sizeof(CheckpointHeader) == 80, "CheckpointHeader harus 80 byte");
+
+size_t recordSize(const CalibrationConfig& config) {
+    return sizeof(RecordHeader) + sizeof(uint64_t) * static_cast<size_t>(config.maxAttempts + 1);
+}
+
+bool validConfig(const CalibrationConfig& config) {
+    return config.digits >= 1 && config.digits <= MULTIPLIER_MAX_DIGITS && config.maxAttempts >= 1 &&
+           config.maxAttempts <= MULTIPLIER_MAX_ATTEMPTS && config.chunkSize > 0 &&
+           !config.strategy.empty() && config.strategy.size() < STRATEGY_NAME_SIZE;
+}
+
+CheckpointHeader makeHeader(const CalibrationConfig& config, CalibrationShard shard) {
+    CheckpointHeader header = {};
+    memcpy(header.magic, CHECKPOINT_MAGIC, sizeof CHECKPOINT_MAGIC);
+    header.version = CHECKPOINT_VERSION;
+    header.recordSize = static_cast<uint32_t>(recordSize(config));
+    header.digits = static_cast<uint32_t>(config.digits);
+    header.maxAttempts = static_cast<uint32_t>(config.maxAttempts);
+    header.chunkSize = config.chunkSize;
+    header.shardIndex = shard.index;
+    header.shardCount = shard.count;
+    header.seed = config.seed;
+    memcpy(header.strategy, config.strategy.data(), config.strategy.size());
+    return header;
+}
+
+// Mengurai seluruh isi checkpoint; validBytes = panjang awalan yang utuh
+bool parseCheckpoint(const unsigned char* data, size_t size, CalibrationConfig& config, CalibrationShard& shard,
+                     vector<CalibrationChunk>& chunks, size_t& validBytes, string& error) {
+    CheckpointHeader header;
+    if (size < sizeof header) {
+        error = "bukan checkpoint kalibrasi";
+        return false;
+    }
+    memcpy(&header, data, sizeof header);
+    if (memcmp(header.magic, CHECKPOINT_MAGIC, sizeof CHECKPOINT_MAGIC) != 0 || header.version != CHECKPOINT_VERSION) {
+        error = "bukan checkpoint kalibrasi";
+        return false;
+    }
+    config.digits = static_cast<int>(header.digits);
+    config.maxAttempts = static_cast<int>(header.maxAttempts);
+    config.chunkSize = header.chunkSize;
+    config.seed = header.seed;
+    config.strategy.assign(header.strategy, strnlen(header.strategy, STRATEGY_NAME_SIZE));
+    shard.index = header.shardIndex;
+    shard.count = header.shardCount;
+    if (!validConfig(config) || header.recordSize != recordSize(config) || shard.count == 0 ||
+        shard.index >= shard.count) {
+        error = "header checkpoint rusak";
+        return false;
+    }
+
+    // Rekaman yang terpotong atau rusak di ujung dibuang; yang sebelumnya tetap berlaku
+    const size_t histogramBytes = header.recordSize - sizeof(RecordHeader);
+    chunks.clear();
+    size_t offset = sizeof header;
+    while (offset + header.recordSize <= size) {
+        RecordHeader record;
+        memcpy(&record, data + offset, sizeof record);
+        const unsigned char* histogram = data + offset + sizeof record;
+        if (crc32(histogram, histogramBytes) != record.checksum || record.index >= config.chunkCount()) break;
+        CalibrationChunk chunk;
+        chunk.index = record.index;
+        chunk.histogram.resize(static_cast<size_t>(config.maxAttempts + 1));
+        memcpy(chunk.histogram.data(), histogram, histogramBytes);
+        chunks.push_back(std::move(chunk));
+        offset += header.recordSize;
+    }
+    validBytes = offset;
+    return true;
+}
+
+string formatSecret(uint64_t value, int digits) {
+    string text(static_cast<size_t>(digits), '0');
+    for (int i = digits - 1; i >= 0; i--) {
+        text[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return text;
+}
+
+} // namespace
+
+uint64_t CalibrationConfig::secrets() const {
+    return powerOfTen(digits);
+}
+
+uint32_t CalibrationConfig::chunkCount() const {
+    return static_cast<uint32_t>((secrets() + chunkSize - 1) / chunkSize);
+}
+
+bool CalibrationConfig::sameAs(const CalibrationConfig& other) const {
+    return digits == other.digits && maxAttempts == other.maxAttempts && strategy == other.strategy &&
+           seed == other.seed && chunkSize == other.chunkSize;
+}
+
+uint32_t CalibrationShard::firstChunk(const CalibrationConfig& config) const {
+    return static_cast<uint32_t>(static_cast<uint64_t>(config.chunkCount()) * index / count);
+}
+
+uint32_t CalibrationShard::endChunk(const CalibrationConfig& config) const {
+    return static_cast<uint32_t>(static_cast<uint64_t>(config.chunkCount()) * (index + 1) / count);
+}
+
+/*
+ * CHECKPOINT
+ */
+bool readCalibrationCheckpoint(const string& path, CalibrationConfig& config, CalibrationShard& shard,
+                               vector<CalibrationChunk>& chunks, string& error) {
+    MappedFile file;
+    if (!file.open(path)) {
+        error = "tidak bisa membuka " + path;
+        return false;
+    }
+    size_t validBytes = 0;
+    if (!parseCheckpoint(file.data(), file.size(), config, shard, chunks, validBytes, error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    return true;
+}
+
+bool CalibrationCheckpoint::open(const string& filePath, const CalibrationConfig& wanted, CalibrationShard wantedShard,
+                                 string& error) {
+    close();
+    if (!validConfig(wanted) || wantedShard.count == 0 || wantedShard.index >= wantedShard.count) {
+        error = "pengaturan kalibrasi tidak sah";
+        return false;
+    }
+    path = filePath;
+    config = wanted;
+    shard = wantedShard;
+
+    // File lama dilanjutkan hanya jika pengaturannya sama persis
+    size_t validBytes = 0;
+    MappedFile existing;
+    if (existing.open(path) && existing.size() > 0) {
+        CalibrationConfig found;
+        CalibrationShard foundShard;
+        if (!parseCheckpoint(existing.data(), existing.size(), found, foundShard, chunks, validBytes, error)) {
+            error = path + ": " + error;
+            return false;
+        }
+        if (!found.sameAs(wanted) || foundShard.index != wantedShard.index || foundShard.count != wantedShard.count) {
+            error = path + " dibuat dengan pengaturan atau shard lain";
+            return false;
+        }
+    }
+    existing.close();
+
+    fd = openFile(path, true);
+    if (fd < 0) {
+        error = "tidak bisa menulis " + path;
+        return false;
+    }
+    bool ok = true;
+    if (validBytes == 0) {
+        CheckpointHeader header = makeHeader(config, shard);
+        ok = truncateFile(fd, 0) && writeFile(fd, &header, sizeof header) && syncFile(fd);
+    } else if (static_cast<long long>(validBytes) != fileSize(fd)) {
+        ok = truncateFile(fd, static_cast<long long>(validBytes));
+    }
+    if (!ok) {
+        error = "gagal menyiapkan " + path;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void CalibrationCheckpoint::close() {
+    if (fd >= 0) closeFile(fd);
+    fd = -1;
+    chunks.clear();
+}
+
+bool CalibrationCheckpoint::append(const CalibrationChunk& chunk) {
+    if (fd < 0 || chunk.histogram.size() != static_cast<size_t>(config.maxAttempts + 1)) return false;
+    const size_t histogramBytes = chunk.histogram.size() * sizeof(uint64_t);
+    vector<unsigned char> record(sizeof(RecordHeader) + histogramBytes);
+    RecordHeader header = {chunk.index, crc32(chunk.histogram.data(), histogramBytes)};
+    memcpy(record.data(), &header, sizeof header);
+    memcpy(record.data() + sizeof header, chunk.histogram.data(), histogramBytes);
+    if (!writeFile(fd, record.data(), record.size()) || !syncFile(fd)) return false;
+    chunks.push_back(chunk);
+    return true;
+}
+
+/*
+ * MENJALANKAN SATU SHARD
+ */
+bool runCalibrationShard(CalibrationCheckpoint& checkpoint, unsigned threads, const CalibrationProgress& progress,
+                         string& error) {
+    const CalibrationConfig& config = checkpoint.getConfig();
+    const CalibrationShard shard = checkpoint.getShard();
+    if (!createStrategy(config.strategy)) {
+        error = "strategi tidak dikenal: " + config.strategy;
+        return false;
+    }
+
+    // Potongan shard yang belum ada di checkpoint
+    vector<bool> done(config.chunkCount(), false);
+    for (const CalibrationChunk& chunk : checkpoint.getChunks()) done[chunk.index] = true;
+    vector<uint32_t> pending;
+    for (uint32_t c = shard.firstChunk(config); c < shard.endChunk(config); c++) {
+        if (!done[c]) pending.push_back(c);
+    }
+    const size_t total = shard.endChunk(config) - shard.firstChunk(config);
+    size_t finished = total - pending.size();
+    if (progress) progress(finished, total);
+    if (pending.empty()) return true;
+
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+    threads = static_cast<unsigned>(min<size_t>(threads, pending.size()));
+    uint64_t seedState = config.seed;
+    const uint64_t strategySeed = Rng::splitmix64(seedState); // Sama seperti runSimulation
+    const GameConfig game{config.digits, config.maxAttempts};
+
+    atomic<size_t> next{0};
+    atomic<bool> failed{false};
+    mutex writeMutex;
+    auto worker = [&]() {
+        unique_ptr<GuessStrategy> strategy = createStrategy(config.strategy);
+        GameCore core(config.digits, config.maxAttempts);
+        CalibrationChunk chunk;
+        while (!failed.load(memory_order_relaxed)) {
+            size_t slot = next.fetch_add(1);
+            if (slot >= pending.size()) return;
+            chunk.index = pending[slot];
+            chunk.histogram.assign(static_cast<size_t>(config.maxAttempts + 1), 0);
+            uint64_t first = static_cast<uint64_t>(chunk.index) * config.chunkSize;
+            uint64_t end = min(config.secrets(), first + config.chunkSize);
+            for (uint64_t secret = first; secret < end; secret++) {
+                core.startNewGame(config.digits, config.maxAttempts, formatSecret(secret, config.digits));
+                strategy->reset(game);
+                Rng rng(strategySeed + secret); // Per angka rahasia, jadi hasil tidak bergantung pembagian kerja
+                while (!core.isOver()) core.submitGuess(strategy->nextGuess(core, rng));
+                chunk.histogram[core.isWon() ? core.getCurrentAttempt() : 0]++;
+            }
+
+            lock_guard<mutex> lock(writeMutex);
+            if (!checkpoint.append(chunk)) {
+                failed.store(true);
+                return;
+            }
+            finished++;
+            if (progress) progress(finished, total);
+        }
+    };
+
+    vector<thread> workers;
+    for (unsigned t = 1; t < threads; t++) workers.emplace_back(worker);
+    worker();
+    for (auto& running : workers) running.join();
+    if (failed.load()) {
+        error = "gagal menulis checkpoint";
+        return false;
+    }
+    return true;
+}
+
+/*
+ * PENGGABUNGAN DAN TABEL
+ */
+bool mergeCalibration(const vector<string>& paths, vector<DifficultyRow>& rows, string& error) {
+    // Satu kelompok per jumlah digit; semua file dalam kelompok harus berpengaturan sama
+    struct Group {
+        CalibrationConfig config;
+        vector<bool> seen;
+        vector<uint64_t> histogram;
+    };
+    vector<Group> groups;
+    for (const string& path : paths) {
+        CalibrationConfig config;
+        CalibrationShard shard;
+        vector<CalibrationChunk> chunks;
+        if (!readCalibrationCheckpoint(path, config, shard, chunks, error)) return false;
+        auto group = find_if(groups.begin(), groups.end(),
+                             [&](const Group& g) { return g.config.digits == config.digits; });
+        if (group == groups.end()) {
+            groups.push_back({config, vector<bool>(config.chunkCount(), false),
+                              vector<uint64_t>(static_cast<size_t>(config.maxAttempts + 1), 0)});
+            group = groups.end() - 1;
+        } else if (!group->config.sameAs(config)) {
+            error = path + ": pengaturan berbeda dengan checkpoint " + to_string(config.digits) + " digit lainnya";
+            return false;
+        }
+        // Potongan yang sama di dua file (shard dijalankan ulang) hanya dihitung sekali
+        for (const CalibrationChunk& chunk : chunks) {
+            if (group->seen[chunk.index]) continue;
+            group->seen[chunk.index] = true;
+            for (size_t n = 0; n < chunk.histogram.size(); n++) group->histogram[n] += chunk.histogram[n];
+        }
+    }
+
+    rows.clear();
+    sort(groups.begin(), groups.end(), [](const Group& a, const Group& b) { return a.config.digits < b.config.digits; });
+    for (const Group& group : groups) {
+        size_t missing = static_cast<size_t>(count(group.seen.begin(), group.seen.end(), false));
+        if (missing > 0) {
+            error = to_string(group.config.digits) + " digit: " + to_string(missing) + " dari " +
+                    to_string(group.seen.size()) + " potongan belum dikerjakan";
+            return false;
+        }
+        // Peluang menang dengan A percobaan = tertebak dalam A langkah atau kurang
+        uint64_t wins = 0;
+        double attemptSum = 0;
+        for (int attempts = 1; attempts <= group.config.maxAttempts; attempts++) {
+            wins += group.histogram[attempts];
+            attemptSum += static_cast<double>(attempts) * group.histogram[attempts];
+            DifficultyRow row;
+            row.digits = group.config.digits;
+            row.attempts = attempts;
+            row.games = group.config.secrets();
+            row.wins = wins;
+            row.expectedAttempts = wins ? attemptSum / wins : 0.0;
+            row.multiplier = wins ? min(MAX_SCORE_MULTIPLIER, 1.0 / row.winRate()) : MAX_SCORE_MULTIPLIER;
+            rows.push_back(row);
+        }
+    }
+    if (rows.empty()) error = "tidak ada checkpoint";
+    return !rows.empty();
+}
+
+bool writeDifficultyTable(const string& path, const vector<DifficultyRow>& rows) {
+    string tempPath = path + ".tmp";
+    {
+        ofstream file(tempPath);
+        if (!file) return false;
+        file << "# SYMBOLIC NUMBLER - tabel pengali skor dari symbolic_calibrate merge\n"
+             << "# digit percobaan pengali peluang_menang rata_rata_percobaan\n";
+        char line[128];
+        for (const DifficultyRow& row : rows) {
+            snprintf(line, sizeof line, "%d %d %.4f %.6f %.4f\n", row.digits, row.attempts, row.multiplier,
+                     row.winRate(), row.expectedAttempts);
+            file << line;
+        }
+        if (!file.flush()) return false;
+    }
+    return replaceFile(tempPath, path);
+}
+
+bool loadDifficultyTable(const string& path) {
+    ifstream file(path);
+    if (!file) return false;
+    string line;
+    vector<DifficultyRow> rows;
+    while (getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        istringstream fields(line);
+        DifficultyRow row;
+        if (!(fields >> row.digits >> row.attempts >> row.multiplier) || row.multiplier <= 0 ||
+            row.multiplier > MAX_SCORE_MULTIPLIER) {
+            return false;
+        }
+        rows.push_back(row);
+    }
+    // Dipasang hanya jika seluruh file sah
+    for (const DifficultyRow& row : rows) setScoreMultiplier(row.digits, row.attempts, row.multiplier);
+    return !rows.empty();
+}
@@ -0,0 +1,120 @@
+/*
+ * SYMBOLIC NUMBLER - KALIBRASI TINGKAT KESULITAN
+ *
+ * Setiap angka rahasia untuk satu jumlah digit dimainkan oleh strategi
+ * acuan sampai menang atau sampai batas percobaan. Strategi tidak melihat
+ * jumlah percobaan maksimum, jadi satu permainan per angka cukup untuk
+ * semua pengaturan (digit, percobaan <= batas): peluang menang dengan A
+ * percobaan adalah bagian angka yang tertebak dalam A langkah atau kurang.
+ *
+ * Ruang angka dibagi menjadi potongan berurutan. Satu proses mengerjakan
+ * satu shard (rentang potongan) dengan beberapa thread, dan setiap potongan
+ * yang selesai ditambahkan ke file checkpoint hanya-tambah, jadi proses
+ * yang dihentikan bisa dilanjutkan. Checkpoint dari semua shard lalu
+ * digabung menjadi tabel pengali skor yang dimuat game saat mulai.
+ */
+#ifndef SYMBOLIC_CALIBRATION_H
+#define SYMBOLIC_CALIBRATION_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+struct CalibrationConfig {
+    int digits = 4;
+    int maxAttempts = 10;               // Batas percobaan; tabel mencakup 1..maxAttempts
+    std::string strategy = "consistent";
+    uint64_t seed = 1;                  // Tebakan acak strategi dibenih per angka rahasia
+    uint32_t chunkSize = 10000;         // Angka rahasia per potongan
+
+    uint64_t secrets() const;           // 10^digits
+    uint32_t chunkCount() const;
+    bool sameAs(const CalibrationConfig& other) const;
+};
+
+// Shard ke-index dari count: potongan [chunkCount * index / count, chunkCount * (index + 1) / count)
+struct CalibrationShard {
+    uint32_t index = 0;
+    uint32_t count = 1;
+
+    uint32_t firstChunk(const CalibrationConfig& config) const;
+    uint32_t endChunk(const CalibrationConfig& config) const;
+};
+
+// Hasil satu potongan: histogram[0] = kalah, histogram[n] = menang di percobaan ke-n
+struct CalibrationChunk {
+    uint32_t index = 0;
+    std::vector<uint64_t> histogram;
+};
+
+/*
+ * CHECKPOINT
+ * Header tetap lalu satu rekaman per potongan selesai. Rekaman terakhir
+ * yang terpotong (proses mati saat menulis) dibuang saat dibuka ulang.
+ */
+class CalibrationCheckpoint {
+private:
+    std::string path;
+    int fd = -1;
+    CalibrationConfig config;
+    CalibrationShard shard;
+    std::vector<CalibrationChunk> chunks;
+
+public:
+    CalibrationCheckpoint() = default;
+    ~CalibrationCheckpoint() { close(); }
+    CalibrationCheckpoint(const CalibrationCheckpoint&) = delete;
+    CalibrationCheckpoint& operator=(const CalibrationCheckpoint&) = delete;
+
+    // Membuat file baru atau melanjutkan file lama dengan pengaturan yang sama
+    bool open(const std::string& filePath, const CalibrationConfig& wanted, CalibrationShard wantedShard,
+              std::string& error);
+    void close();
+
+    // Tidak aman dipanggil bersamaan; pemanggil memegang kunci
+    bool append(const CalibrationChunk& chunk);
+
+    const std::vector<CalibrationChunk>& getChunks() const { return chunks; }
+    const CalibrationConfig& getConfig() const { return config; }
+    CalibrationShard getShard() const { return shard; }
+};
+
+// Membaca checkpoint tanpa membukanya untuk ditulis (untuk penggabungan)
+bool readCalibrationCheckpoint(const std::string& path, CalibrationConfig& config, CalibrationShard& shard,
+                               std::vector<CalibrationChunk>& chunks, std::string& error);
+
+// Dipanggil setelah setiap potongan selesai (dari thread pekerja, di bawah kunci)
+using CalibrationProgress = std::function<void(size_t chunksDone, size_t chunksTotal)>;
+
+// Mengerjakan potongan shard yang belum ada di checkpoint dengan `threads` thread (0 = semua inti)
+bool runCalibrationShard(CalibrationCheckpoint& checkpoint, unsigned threads, const CalibrationProgress& progress,
+                         std::string& error);
+
+/*
+ * TABEL PENGALI SKOR
+ * pengali = 1 / peluang menang (paling besar MAX_SCORE_MULTIPLIER), jadi
+ * skor rata-rata per permainan yang dimulai sama untuk setiap pengaturan.
+ */
+constexpr double MAX_SCORE_MULTIPLIER = 8.0;
+
+struct DifficultyRow {
+    int digits = 0;
+    int attempts = 0;
+    uint64_t games = 0;
+    uint64_t wins = 0;
+    double expectedAttempts = 0.0; // Rata-rata percobaan dari permainan yang dimenangkan
+    double multiplier = 1.0;
+
+    double winRate() const { return games ? static_cast<double>(wins) / games : 0.0; }
+};
+
+// Menggabungkan checkpoint (boleh beberapa jumlah digit); gagal jika ada potongan yang belum dikerjakan
+bool mergeCalibration(const std::vector<std::string>& paths, std::vector<DifficultyRow>& rows, std::string& error);
+
+bool writeDifficultyTable(const std::string& path, const std::vector<DifficultyRow>& rows);
+
+// Memasang pengali dari tabel ke calculateScore; false jika file tidak ada atau rusak
+bool loadDifficultyTable(const std::string& path);
+
+#endif
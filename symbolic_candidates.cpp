@@ -0,0 +1,231 @@
+#include "symbolic_candidates.h"
+#include "symbolic_alloc.h"
+#include "symbolic_strategy.h"
+#include "symbolic_trace.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SYMBOLIC_HAVE_SSE2_MASK 1
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+int popcount64(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// Posisi bit menyala terendah, x != 0
+int lowestBit(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    return popcount64((x & (0 - x)) - 1);
+#endif
+}
+
+// Bit i menyala jika codes[i] == wanted, untuk 64 kode
+uint64_t matchMask(const uint16_t* codes, uint16_t wanted) {
+#ifdef SYMBOLIC_HAVE_SSE2_MASK
+    const __m128i target = _mm_set1_epi16(static_cast<short>(wanted));
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; i += 16) {
+        __m128i low = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + i)), target);
+        __m128i high = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + i + 8)), target);
+        // packs mempertahankan urutan lajur: 16 kode menjadi 16 bit movemask
+        uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(low, high)));
+        mask |= static_cast<uint64_t>(bits) << i;
+    }
+    return mask;
+#else
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; i++) mask |= static_cast<uint64_t>(codes[i] == wanted) << i;
+    return mask;
+#endif
+}
+
+string formatCandidate(uint64_t value, int digits) {
+    string out(static_cast<size_t>(digits), '0');
+    for (int i = digits - 1; i >= 0; i--) {
+        out[static_cast<size_t>(i)] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out;
+}
+
+} // namespace
+
+void CandidateTracker::reset(int numDigits) {
+    digits = numDigits;
+    applied = 0;
+    words.clear();
+    if (numDigits < 1 || numDigits > CANDIDATE_MAX_DIGITS) {
+        mode = Mode::INACTIVE;
+        space = remaining = 0;
+        return;
+    }
+    mode = Mode::FULL;
+    space = powerOfTen(numDigits);
+    remaining = static_cast<size_t>(space);
+    // Buffer dipakai ulang antar permainan dengan jumlah digit yang sama
+    if (block.getDigits() != numDigits) block = sparse = PackedCandidates(numDigits);
+}
+
+void CandidateTracker::apply(const string& guess, const string& result, ArrowHint hint) {
+    applied++;
+    if (mode == Mode::INACTIVE || guess.size() != static_cast<size_t>(digits)) return;
+    SYMBOLIC_TRACE_SCOPE(TracePhase::CANDIDATES);
+
+    if (mode == Mode::SPARSE) {
+        filterCandidates(sparse, guess, result, hint, scratch, codes);
+        swap(sparse, scratch);
+        remaining = sparse.size();
+        return;
+    }
+    if (mode == Mode::FULL) {
+        // Bitset baru dibuat saat tebakan pertama; bit di atas 10^digits dimatikan
+        words.assign(static_cast<size_t>((space + 63) / 64), ~uint64_t{0});
+        if (space % 64) words.back() = (uint64_t{1} << (space % 64)) - 1;
+        mode = Mode::DENSE;
+    }
+    applyDense(guess, feedbackCode(result), hint);
+    if (remaining <= space / SPARSE_RATIO) makeSparse();
+}
+
+void CandidateTracker::applyDense(const string& guess, uint16_t wanted, ArrowHint hint) {
+    // Panah: semua kata di luar [lo, hi) dikosongkan sekaligus, kata tepi diberi topeng
+    uint64_t lo = 0, hi = space;
+    uint64_t value = stoull(guess);
+    if (hint == ArrowHint::UP) lo = value + 1;
+    else if (hint == ArrowHint::DOWN) hi = value;
+    size_t firstWord = static_cast<size_t>(lo / 64);
+    size_t endWord = static_cast<size_t>(min<uint64_t>((hi + 63) / 64, words.size()));
+    if (lo >= hi) firstWord = endWord = 0;
+    fill(words.begin(), words.begin() + firstWord, 0);
+    fill(words.begin() + endWord, words.end(), 0);
+    if (firstWord < endWord) {
+        if (lo % 64) words[firstWord] &= ~uint64_t{0} << (lo % 64);
+        if (hi % 64) words[endWord - 1] &= (uint64_t{1} << (hi % 64)) - 1;
+    }
+
+    // Umpan balik: per blok, hanya rentang dari kata hidup pertama sampai terakhir yang dinilai
+    size_t total = 0;
+    for (size_t start = firstWord; start < endWord; start += BLOCK_WORDS) {
+        size_t stop = min(start + BLOCK_WORDS, endWord);
+        size_t first = start;
+        while (first < stop && words[first] == 0) first++;
+        if (first == stop) continue;
+        size_t last = stop - 1;
+        while (words[last] == 0) last--;
+
+        uint64_t begin = static_cast<uint64_t>(first) * 64;
+        size_t count = static_cast<size_t>(min<uint64_t>(static_cast<uint64_t>(last + 1) * 64, space) - begin);
+        block.assignRange(begin, count);
+        codes.resize((last + 1 - first) * 64);
+        scoreGuessBatch(guess, block, 0, count, codes.data());
+        fill(codes.begin() + count, codes.end(), uint16_t{0xFFFF}); // Di atas 10^digits, tidak pernah cocok
+
+        for (size_t w = first; w <= last; w++) {
+            if (words[w] == 0) continue;
+            words[w] &= matchMask(&codes[(w - first) * 64], wanted);
+            total += static_cast<size_t>(popcount64(words[w]));
+        }
+    }
+    remaining = total;
+}
+
+void CandidateTracker::makeSparse() {
+    sparse.clear();
+    sparse.reserve(remaining);
+    for (size_t w = 0; w < words.size(); w++) {
+        for (uint64_t bits = words[w]; bits; bits &= bits - 1) {
+            sparse.push(static_cast<uint64_t>(w) * 64 + static_cast<uint64_t>(lowestBit(bits)));
+        }
+    }
+    vector<uint64_t>().swap(words); // Bitset dilepas; sesi server tidak menyimpan 125 KB per pemain
+    mode = Mode::SPARSE;
+}
+
+void CandidateTracker::sync(const GameCore& core) {
+    SYMBOLIC_ALLOC_SCOPE(AllocPhase::EVALUATE);
+    if (core.getDigits() != digits || core.getGuessCount() < applied) reset(core.getDigits());
+    while (applied < core.getGuessCount()) {
+        size_t i = applied;
+        apply(core.getGuess(i), core.getResult(i), core.getHints()[i]);
+    }
+}
+
+uint64_t CandidateTracker::valueAt(size_t rank) const {
+    if (mode == Mode::FULL) return rank;
+    if (mode == Mode::SPARSE) return sparse.value(rank);
+    for (size_t w = 0; w < words.size(); w++) {
+        size_t bits = static_cast<size_t>(popcount64(words[w]));
+        if (rank >= bits) {
+            rank -= bits;
+            continue;
+        }
+        uint64_t word = words[w];
+        for (; rank > 0; rank--) word &= word - 1;
+        return static_cast<uint64_t>(w) * 64 + static_cast<uint64_t>(lowestBit(word));
+    }
+    return 0;
+}
+
+string CandidateTracker::candidate(size_t rank) const {
+    return formatCandidate(valueAt(rank), digits);
+}
+
+size_t CandidateTracker::list(vector<string>& out, size_t limit) const {
+    limit = min(limit, remaining);
+    if (mode != Mode::DENSE) {
+        for (size_t i = 0; i < limit; i++) out.push_back(candidate(i));
+        return limit;
+    }
+    size_t added = 0;
+    for (size_t w = 0; w < words.size() && added < limit; w++) {
+        for (uint64_t bits = words[w]; bits && added < limit; bits &= bits - 1, added++) {
+            out.push_back(formatCandidate(static_cast<uint64_t>(w) * 64 + static_cast<uint64_t>(lowestBit(bits)), digits));
+        }
+    }
+    return added;
+}
+
+string CandidateTracker::sample(Rng& rng) const {
+    if (remaining == 0) return "";
+    return candidate(static_cast<size_t>(rng.below(remaining)));
+}
+
+string describeCandidates(const CandidateTracker& tracker, Rng& rng, size_t shown) {
+    if (!tracker.isActive()) return "Daftar kemungkinan tidak tersedia untuk angka sepanjang ini.";
+    const size_t count = tracker.count();
+    if (count == 0) return "Tidak ada angka yang cocok dengan semua petunjuk.";
+
+    vector<string> numbers;
+    string text;
+    if (count <= shown) {
+        tracker.list(numbers, shown);
+        text = "Kemungkinan (" + to_string(count) + "):";
+    } else {
+        // Peringkat acak berbeda, diurutkan agar mudah dibaca
+        vector<size_t> ranks;
+        while (ranks.size() < shown) {
+            size_t rank = static_cast<size_t>(rng.below(count));
+            if (find(ranks.begin(), ranks.end(), rank) == ranks.end()) ranks.push_back(rank);
+        }
+        sort(ranks.begin(), ranks.end());
+        for (size_t rank : ranks) numbers.push_back(tracker.candidate(rank));
+        text = "Contoh dari " + to_string(count) + " kemungkinan:";
+    }
+    for (const string& number : numbers) text += " " + number;
+    return text;
+}
@@ -0,0 +1,83 @@
+/*
+ * SYMBOLIC NUMBLER - PELACAK KANDIDAT INKREMENTAL
+ *
+ * Menyimpan semua angka rahasia yang masih cocok dengan setiap tebakan,
+ * hasil dan panah sejauh ini, dan memperbaruinya per tebakan alih-alih
+ * menghitung ulang dari awal:
+ *
+ *   PENUH  - belum ada tebakan, tanpa memori (kandidat ke-k adalah k)
+ *   PADAT  - bitset atas ruang 10^digits; panah menghapus kata 64-bit
+ *            sekaligus, blok yang masih hidup dinilai dengan kernel
+ *            umpan balik SIMD lalu dijadikan topeng dengan movemask
+ *   JARANG - daftar terkemas setelah sisanya sedikit (paling banyak
+ *            1/16 ruang), bitset dilepas; menyaring daftar pendek lebih
+ *            murah daripada menilai ulang blok padat yang jarang terisi
+ *
+ * Tebakan pertama 6 digit (satu juta kandidat) selesai jauh di bawah satu
+ * frame; lihat "candidates/..." di benchmark.
+ */
+#ifndef SYMBOLIC_CANDIDATES_H
+#define SYMBOLIC_CANDIDATES_H
+
+#include "symbolic_core.h"
+#include "symbolic_feedback.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Di atas ini ruang angka terlalu besar untuk dilacak (mode maraton, dsb.)
+constexpr int CANDIDATE_MAX_DIGITS = 7;
+
+class CandidateTracker {
+public:
+    enum class Mode { INACTIVE, FULL, DENSE, SPARSE };
+
+private:
+    static constexpr size_t BLOCK_WORDS = 64; // Satu panggilan kernel menilai paling banyak 4096 angka
+    static constexpr uint64_t SPARSE_RATIO = 16; // JARANG jika sisa <= ruang / 16
+
+    Mode mode = Mode::INACTIVE;
+    int digits = 0;
+    uint64_t space = 0;
+    size_t remaining = 0;
+    size_t applied = 0;           // Jumlah tebakan GameCore yang sudah diterapkan (untuk sync)
+    std::vector<uint64_t> words;  // PADAT: bit v menyala jika angka v masih mungkin
+    PackedCandidates sparse;      // JARANG: kandidat terurut naik
+    PackedCandidates block, scratch;
+    std::vector<uint16_t> codes;
+
+    void applyDense(const std::string& guess, uint16_t wanted, ArrowHint hint);
+    void makeSparse();
+    uint64_t valueAt(size_t rank) const;
+
+public:
+    // digits di luar 1..CANDIDATE_MAX_DIGITS membuat pelacak tidak aktif
+    void reset(int numDigits);
+
+    // Menyaring dengan satu tebakan, hasil (G/Y/X) dan panahnya
+    void apply(const std::string& guess, const std::string& result, ArrowHint hint);
+
+    // Menerapkan tebakan GameCore yang belum diterapkan; reset sendiri jika permainan berganti
+    void sync(const GameCore& core);
+
+    bool isActive() const { return mode != Mode::INACTIVE; }
+    Mode getMode() const { return mode; }
+    int getDigits() const { return digits; }
+    size_t count() const { return remaining; }
+
+    // Kandidat ke-rank dalam urutan naik (rank < count())
+    std::string candidate(size_t rank) const;
+
+    // Paling banyak limit kandidat terkecil, ditambahkan ke out; mengembalikan jumlah yang ditambahkan
+    size_t list(std::vector<std::string>& out, size_t limit) const;
+
+    // Satu kandidat acak seragam; kosong jika tidak ada
+    std::string sample(Rng& rng) const;
+};
+
+// Satu baris untuk layar: semua kandidat jika paling banyak shown, selain itu contoh acak terurut
+std::string describeCandidates(const CandidateTracker& tracker, Rng& rng, size_t shown);
+
+#endif
@@ -0,0 +1,152 @@
+#include "symbolic_core.h"
+#include "symbolic_alloc.h"
+#include "symbolic_engine.h"
+#include "symbolic_trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+using namespace std;
+
+namespace {
+
+// Dibagi semua sesi di server, jadi atomik
+atomic<uint64_t> nextGameId{1};
+
+// Indeks [digit][percobaan]; 0 berarti belum diisi (pengali 1)
+double multipliers[MULTIPLIER_MAX_DIGITS + 1][MULTIPLIER_MAX_ATTEMPTS + 1] = {};
+
+} // namespace
+
+// Hijau dulu, lalu kuning dari kiri ke kanan memakai digit target yang tersisa.
+// Sisa digit target dihitung per nilai, jadi O(n) tanpa mencari ulang.
+string evaluateGuess(const string& target, const string& guess) {
+    string result(guess.length(), 'X');
+    size_t remaining[256] = {};
+    for (size_t i = 0; i < guess.length(); i++) {
+        if (i < target.length() && guess[i] == target[i]) result[i] = 'G';
+    }
+    for (size_t j = 0; j < target.length(); j++) {
+        if (j >= guess.length() || result[j] != 'G') remaining[static_cast<unsigned char>(target[j])]++;
+    }
+    for (size_t i = 0; i < guess.length(); i++) {
+        size_t& left = remaining[static_cast<unsigned char>(guess[i])];
+        if (result[i] != 'G' && left > 0) {
+            result[i] = 'Y';
+            left--;
+        }
+    }
+    return result;
+}
+
+// Panjang sama, jadi perbandingan string setara dengan perbandingan angka
+ArrowHint arrowHint(const string& target, const string& guess) {
+    if (guess == target) return ArrowHint::NONE;
+    return (guess < target) ? ArrowHint::UP : ArrowHint::DOWN;
+}
+
+double scoreMultiplier(int digits, int maxAttempts) {
+    if (digits < 1 || digits > MULTIPLIER_MAX_DIGITS || maxAttempts < 1 || maxAttempts > MULTIPLIER_MAX_ATTEMPTS) return 1.0;
+    double multiplier = multipliers[digits][maxAttempts];
+    return multiplier > 0 ? multiplier : 1.0;
+}
+
+void setScoreMultiplier(int digits, int maxAttempts, double multiplier) {
+    if (digits < 1 || digits > MULTIPLIER_MAX_DIGITS || maxAttempts < 1 || maxAttempts > MULTIPLIER_MAX_ATTEMPTS) return;
+    multipliers[digits][maxAttempts] = multiplier;
+}
+
+// Menghitung skor berdasarkan sisa percobaan dan jumlah digit, dikali tingkat kesulitan pengaturan
+int calculateScore(int maxAttempts, int attemptsUsed, int digits) {
+    int base = (maxAttempts - attemptsUsed + 1) * digits * 50;
+    return static_cast<int>(lround(base * scoreMultiplier(digits, maxAttempts)));
+}
+
+// Mode speedrun: skor biasa dikali par / (par + waktu), par 10 detik per digit
+int calculateTimedScore(int maxAttempts, int attemptsUsed, int digits, int64_t elapsedMs) {
+    int64_t parMs = static_cast<int64_t>(digits) * 10000;
+    int64_t base = calculateScore(maxAttempts, attemptsUsed, digits);
+    return static_cast<int>(base * parMs / (parMs + max<int64_t>(elapsedMs, 0)));
+}
+
+// Sama dengan evaluateGuess, tetapi langsung per byte (dua posisi sekaligus)
+void evaluatePacked(const PackedDigits& target, const PackedDigits& guess, PackedDigits& result) {
+    const size_t n = guess.size();
+    const size_t bytes = guess.byteSize();
+    if (result.size() != n) result = PackedDigits(n);
+    const uint8_t* t = target.data();
+    const uint8_t* g = guess.data();
+    uint8_t* out = result.data();
+
+    // Hijau per nibble; sisa digit target dihitung per nilai
+    size_t remaining[16] = {};
+    for (size_t k = 0; k < bytes; k++) {
+        uint8_t code = 0;
+        if ((t[k] ^ g[k]) & 0xF0) remaining[t[k] >> 4]++;
+        else code = 0x20;
+        if ((t[k] ^ g[k]) & 0x0F) remaining[t[k] & 0x0F]++;
+        else code |= 0x02;
+        out[k] = code;
+    }
+    // Nibble pengisi (panjang ganjil) bernilai 0 di kedua sisi: tidak dihitung, hasilnya dikosongkan
+    if (n & 1) out[bytes - 1] &= 0xF0;
+
+    // Kuning dari kiri ke kanan selama digit target masih tersisa
+    for (size_t k = 0; k < bytes; k++) {
+        uint8_t code = out[k];
+        if (!(code & 0x20) && remaining[g[k] >> 4] > 0) {
+            remaining[g[k] >> 4]--;
+            code |= 0x10;
+        }
+        bool padding = (n & 1) && k == bytes - 1;
+        if (!padding && !(code & 0x02) && remaining[g[k] & 0x0F] > 0) {
+            remaining[g[k] & 0x0F]--;
+            code |= 0x01;
+        }
+        out[k] = code;
+    }
+}
+
+ArrowHint arrowHint(const PackedDigits& target, const PackedDigits& guess) {
+    int order = guess.compare(target);
+    if (order == 0) return ArrowHint::NONE;
+    return (order < 0) ? ArrowHint::UP : ArrowHint::DOWN;
+}
+
+GameCore::GameCore(int initial_digits, int initial_attempts)
+    : target(static_cast<size_t>(initial_digits)), maxAttempts(initial_attempts), currentAttempt(0), digits(initial_digits),
+      evaluator(guessEvaluator(initial_digits)) {}
+
+void GameCore::startNewGame(int newDigits, int newAttempts, Rng& rng) {
+    startNewGame(newDigits, newAttempts, generateTarget(newDigits, rng));
+}
+
+void GameCore::startNewGame(int newDigits, int newAttempts, const string& fixedTarget) {
+    digits = newDigits;
+    maxAttempts = newAttempts;
+    currentAttempt = 0;
+    gameId = nextGameId.fetch_add(1, memory_order_relaxed);
+    evaluator = guessEvaluator(newDigits);
+    guesses.clear();
+    results.clear();
+    hints.clear();
+    // Kapasitas tetap terpakai ulang antar permainan
+    guesses.reserve(static_cast<size_t>(newAttempts));
+    results.reserve(static_cast<size_t>(newAttempts));
+    hints.reserve(static_cast<size_t>(newAttempts));
+    target = PackedDigits::fromString(fixedTarget);
+}
+
+void GameCore::submitGuess(const string& guess) {
+    SYMBOLIC_ALLOC_SCOPE(AllocPhase::EVALUATE);
+    guesses.push_back(PackedDigits::fromString(guess));
+    results.emplace_back();
+    ArrowHint hint;
+    {
+        SYMBOLIC_TRACE_SCOPE(TracePhase::EVALUATE);
+        hint = evaluator(target, guesses.back(), results.back());
+    }
+    hints.push_back(hint);
+    currentAttempt++;
+}
@@ -0,0 +1,112 @@
+/*
+ * SYMBOLIC NUMBLER - INTI PERMAINAN (TANPA KONSOL)
+ *
+ * Logika permainan murni: pembuatan target, evaluasi tebakan, petunjuk
+ * panah dan skor. Tidak ada ketergantungan ke terminal sehingga bisa
+ * dipakai oleh game interaktif maupun simulasi massal.
+ */
+#ifndef SYMBOLIC_CORE_H
+#define SYMBOLIC_CORE_H
+
+#include "symbolic_digits.h"
+#include "symbolic_random.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Pengaturan satu permainan
+struct GameConfig {
+    int digits;
+    int maxAttempts;
+};
+
+// Batas jumlah digit: mode kustom 3-6, mode maraton 10 sampai ribuan digit
+constexpr int CUSTOM_MIN_DIGITS = 3;
+constexpr int CUSTOM_MAX_DIGITS = 6;
+constexpr int MARATHON_MIN_DIGITS = 10;
+constexpr int MARATHON_MAX_DIGITS = 4096;
+constexpr int MARATHON_MAX_ATTEMPTS = 30;
+
+// Petunjuk panah: arah angka rahasia relatif terhadap tebakan
+enum class ArrowHint {
+    NONE, // Tebakan benar
+    UP,   // Target lebih tinggi
+    DOWN  // Target lebih rendah
+};
+
+// FUNGSI LOGIKA (BEBAS STATUS)
+std::string evaluateGuess(const std::string& target, const std::string& guess);
+ArrowHint arrowHint(const std::string& target, const std::string& guess);
+
+int calculateScore(int maxAttempts, int attemptsUsed, int digits);
+int calculateTimedScore(int maxAttempts, int attemptsUsed, int digits, int64_t elapsedMs);
+
+// Pengali skor per (digit, percobaan) dari tabel kalibrasi (symbolic_calibration.h);
+// 1 untuk pengaturan di luar tabel. Diisi sekali saat program mulai.
+constexpr int MULTIPLIER_MAX_DIGITS = 9;
+constexpr int MULTIPLIER_MAX_ATTEMPTS = 32;
+double scoreMultiplier(int digits, int maxAttempts);
+void setScoreMultiplier(int digits, int maxAttempts, double multiplier);
+
+// Versi terkemas, O(n): result berisi kode X=0, Y=1, G=2 per posisi
+void evaluatePacked(const PackedDigits& target, const PackedDigits& guess, PackedDigits& result);
+ArrowHint arrowHint(const PackedDigits& target, const PackedDigits& guess);
+
+// Menilai guess terhadap target, menulis hasil terkemas dan mengembalikan panah;
+// spesialisasi per jumlah digit ada di symbolic_engine.h
+using GuessEvaluator = ArrowHint (*)(const PackedDigits& target, const PackedDigits& guess, PackedDigits& result);
+
+/*
+ * STATUS SATU PERMAINAN
+ */
+class GameCore {
+private:
+    // Semua disimpan terkemas 4 bit agar permainan maraton tetap ringan
+    PackedDigits target;
+    std::vector<PackedDigits> guesses;
+    std::vector<PackedDigits> results;
+    std::vector<ArrowHint> hints;
+    int maxAttempts;
+    int currentAttempt;
+    int digits;
+    GuessEvaluator evaluator;  // Dipilih per jumlah digit di startNewGame
+    uint64_t gameId = 0; // Baru setiap startNewGame, ikut tersalin bersama status
+
+public:
+    GameCore(int initial_digits = 4, int initial_attempts = 6);
+
+    // Memulai permainan baru dengan target acak atau target tertentu
+    void startNewGame(int newDigits, int newAttempts, Rng& rng);
+    void startNewGame(int newDigits, int newAttempts, const std::string& fixedTarget);
+
+    // Mencatat satu tebakan; hasilnya (G/Y/X) lewat getResult. Riwayat
+    // dipesan saat permainan dimulai, jadi sampai 16 digit tidak mengalokasikan
+    // selama jumlah tebakan tidak melewati maxAttempts
+    void submitGuess(const std::string& guess);
+
+    bool isWon() const { return !guesses.empty() && guesses.back() == target; }
+    bool isMarathon() const { return digits >= MARATHON_MIN_DIGITS; }
+    bool isOver() const { return isWon() || currentAttempt >= maxAttempts; }
+    int calculateScore() const { return ::calculateScore(maxAttempts, currentAttempt, digits); }
+
+    // Akses status (strategi tidak boleh membaca getTarget())
+    // Akses teks dibuat dari bentuk terkemas setiap kali dipanggil
+    std::string getTarget() const { return target.toString(); }
+    size_t getGuessCount() const { return guesses.size(); }
+    std::string getGuess(size_t i) const { return guesses[i].toString(); }
+    std::string getResult(size_t i) const { return results[i].toString(FEEDBACK_ALPHABET); }
+    const PackedDigits& getPackedGuess(size_t i) const { return guesses[i]; }
+    const PackedDigits& getPackedResult(size_t i) const { return results[i]; }
+    const std::vector<ArrowHint>& getHints() const { return hints; }
+    int getDigits() const { return digits; }
+    int getMaxAttempts() const { return maxAttempts; }
+    int getCurrentAttempt() const { return currentAttempt; }
+    int getRemainingAttempts() const { return maxAttempts - currentAttempt; }
+
+    // Pengenal permainan yang unik di seluruh proses; tampilan memakainya
+    // untuk tahu kapan tebakan yang sudah digambar tidak berlaku lagi
+    uint64_t getGameId() const { return gameId; }
+};
+
+#endif
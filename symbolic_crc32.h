@@ -0,0 +1,56 @@
+/*
+ * SYMBOLIC NUMBLER - CRC-32 (IEEE 802.3)
+ *
+ * Tabel dibuat saat kompilasi. Dipakai untuk checksum rekaman di file biner.
+ * Blok rekaman permainan bisa berukuran puluhan KiB, jadi badan data
+ * diproses 8 byte sekaligus (slicing-by-8) dengan delapan tabel.
+ */
+#ifndef SYMBOLIC_CRC32_H
+#define SYMBOLIC_CRC32_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace crc32_detail {
+
+// tables[k][b]: CRC byte b yang diikuti k byte nol
+constexpr std::array<std::array<uint32_t, 256>, 8> makeTables() {
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        tables[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (size_t k = 1; k < 8; k++) tables[k][i] = tables[0][tables[k - 1][i] & 0xFF] ^ (tables[k - 1][i] >> 8);
+    }
+    return tables;
+}
+
+inline constexpr std::array<std::array<uint32_t, 256>, 8> TABLES = makeTables();
+inline constexpr const std::array<uint32_t, 256>& TABLE = TABLES[0];
+
+} // namespace crc32_detail
+
+// Bisa disambung: crc32(b, nb, crc32(a, na))
+inline uint32_t crc32(const void* data, size_t size, uint32_t previous = 0) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint32_t c = previous ^ 0xFFFFFFFFu;
+    using crc32_detail::TABLES;
+    size_t i = 0;
+    // Urutan byte little-endian (x86, ARM): byte pertama di bit terendah
+    for (; i + 8 <= size; i += 8) {
+        uint32_t low, high;
+        std::memcpy(&low, bytes + i, 4);
+        std::memcpy(&high, bytes + i + 4, 4);
+        low ^= c;
+        c = TABLES[7][low & 0xFF] ^ TABLES[6][(low >> 8) & 0xFF] ^ TABLES[5][(low >> 16) & 0xFF] ^ TABLES[4][low >> 24] ^
+            TABLES[3][high & 0xFF] ^ TABLES[2][(high >> 8) & 0xFF] ^ TABLES[1][(high >> 16) & 0xFF] ^ TABLES[0][high >> 24];
+    }
+    for (; i < size; i++) c = crc32_detail::TABLE[(c ^ bytes[i]) & 0xFF] ^ (c >> 8);
+    return c ^ 0xFFFFFFFFu;
+}
+
+#endif
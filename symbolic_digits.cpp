@@ -0,0 +1,45 @@
+#include "symbolic_digits.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+PackedDigits PackedDigits::fromString(const string& text, const char* alphabet) {
+    // Tabel balik dibuat sekali per panggilan: 256 byte, jauh lebih murah dari strchr per karakter
+    uint8_t lookup[256] = {};
+    for (uint8_t value = 0; alphabet[value] != '\0'; value++) lookup[static_cast<unsigned char>(alphabet[value])] = value;
+
+    PackedDigits packed(text.size());
+    uint8_t* bytes = packed.data();
+    const unsigned char* source = reinterpret_cast<const unsigned char*>(text.data());
+    size_t pairs = text.size() / 2;
+    for (size_t k = 0; k < pairs; k++) {
+        bytes[k] = static_cast<uint8_t>((lookup[source[2 * k]] << 4) | lookup[source[2 * k + 1]]);
+    }
+    if (text.size() & 1) bytes[pairs] = static_cast<uint8_t>(lookup[source[text.size() - 1]] << 4);
+    return packed;
+}
+
+string PackedDigits::toString(const char* alphabet) const {
+    string text;
+    toString(text, alphabet);
+    return text;
+}
+
+void PackedDigits::toString(string& text, const char* alphabet) const {
+    const uint8_t* bytes = data();
+    text.resize(count);
+    for (size_t k = 0; k < count / 2; k++) {
+        text[2 * k] = alphabet[bytes[k] >> 4];
+        text[2 * k + 1] = alphabet[bytes[k] & 0x0F];
+    }
+    if (count & 1) text[count - 1] = alphabet[bytes[count / 2] >> 4];
+}
+
+int PackedDigits::compare(const PackedDigits& other) const {
+    size_t length = min(byteSize(), other.byteSize());
+    int order = length ? memcmp(data(), other.data(), length) : 0;
+    if (order != 0) return order;
+    return (byteSize() < other.byteSize()) ? -1 : (byteSize() > other.byteSize()) ? 1 : 0;
+}
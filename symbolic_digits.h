@@ -0,0 +1,71 @@
+/*
+ * SYMBOLIC NUMBLER - DIGIT TERKEMAS 4 BIT
+ *
+ * Target, tebakan dan hasil disimpan dua nilai per byte (nilai pertama di
+ * nibble atas) sehingga permainan maraton ribuan digit tetap kecil di
+ * memori. Untuk panjang yang sama, urutan byte mentah sama dengan urutan
+ * angka, jadi perbandingan cukup memcmp.
+ *
+ * Sampai 16 digit (semua mode kustom) byte disimpan langsung di objek,
+ * jadi membuat, menyalin dan menilai tebakan biasa tidak mengalokasikan.
+ */
+#ifndef SYMBOLIC_DIGITS_H
+#define SYMBOLIC_DIGITS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Huruf untuk setiap nilai nibble saat diubah ke/dari teks
+constexpr const char* DIGIT_ALPHABET = "0123456789";
+constexpr const char* FEEDBACK_ALPHABET = "XYG"; // X=0, Y=1, G=2 seperti kode di symbolic_feedback.h
+
+class PackedDigits {
+public:
+    static constexpr size_t INLINE_BYTES = 8;
+
+private:
+    std::array<uint8_t, INLINE_BYTES> small{}; // Dipakai jika byteSize() <= INLINE_BYTES
+    std::vector<uint8_t> large;                // Hanya untuk angka maraton
+    size_t count = 0;
+
+    bool isInline() const { return byteSize() <= INLINE_BYTES; }
+
+public:
+    PackedDigits() = default;
+    explicit PackedDigits(size_t size) : count(size) {
+        if (!isInline()) large.assign(byteSize(), 0);
+    }
+
+    // Karakter di luar alphabet disimpan sebagai 0
+    static PackedDigits fromString(const std::string& text, const char* alphabet = DIGIT_ALPHABET);
+    std::string toString(const char* alphabet = DIGIT_ALPHABET) const;
+    // Menulis ke string yang sudah ada; tanpa alokasi jika kapasitasnya cukup
+    void toString(std::string& out, const char* alphabet = DIGIT_ALPHABET) const;
+
+    size_t size() const { return count; }
+    size_t byteSize() const { return (count + 1) / 2; }
+
+    // Byte mentah untuk loop cepat; nibble sisa di byte terakhir selalu 0
+    const uint8_t* data() const { return isInline() ? small.data() : large.data(); }
+    uint8_t* data() { return isInline() ? small.data() : large.data(); }
+
+    uint8_t at(size_t i) const {
+        uint8_t pair = data()[i >> 1];
+        return (i & 1) ? (pair & 0x0F) : (pair >> 4);
+    }
+    void set(size_t i, uint8_t value) {
+        uint8_t& pair = data()[i >> 1];
+        pair = (i & 1) ? static_cast<uint8_t>((pair & 0xF0) | value) : static_cast<uint8_t>((pair & 0x0F) | (value << 4));
+    }
+
+    // <0, 0 atau >0 seperti memcmp; hanya bermakna untuk panjang yang sama
+    int compare(const PackedDigits& other) const;
+
+    bool operator==(const PackedDigits& other) const { return count == other.count && compare(other) == 0; }
+    bool operator!=(const PackedDigits& other) const { return !(*this == other); }
+};
+
+#endif
@@ -0,0 +1,13 @@
+#include "symbolic_engine.h"
+
+ArrowHint evaluateGeneric(const PackedDigits& target, const PackedDigits& guess, PackedDigits& result) {
+    evaluatePacked(target, guess, result);
+    return arrowHint(target, guess);
+}
+
+GuessEvaluator guessEvaluator(int digits) {
+    return dispatchDigits(digits, [](auto size) -> GuessEvaluator {
+        if constexpr (decltype(size)::value == 0) return evaluateGeneric;
+        else return evaluateFixed<decltype(size)::value>;
+    });
+}
@@ -0,0 +1,113 @@
+/*
+ * SYMBOLIC NUMBLER - MESIN EVALUASI PER JUMLAH DIGIT
+ *
+ * Mode kustom hanya memakai 3-6 digit, jadi untuk setiap ukuran itu ada
+ * spesialisasi saat kompilasi: semua digit dikemas ke satu uint32_t
+ * (nibble per digit, digit pertama paling tinggi) sehingga perbandingan
+ * bilangan bulat sama dengan perbandingan angka, dan evaluasi dibuka penuh
+ * tanpa loop dan tanpa cabang bergantung data.
+ *
+ * GameCore memilih evaluator sekali per permainan lewat guessEvaluator();
+ * ukuran lain (maraton) memakai evaluatePacked yang umum. Hasilnya identik
+ * nibble demi nibble dengan evaluatePacked. Status permainan tidak
+ * dispesialisasi: GameCore tetap menyimpan riwayat di vector terkemas.
+ */
+#ifndef SYMBOLIC_ENGINE_H
+#define SYMBOLIC_ENGINE_H
+
+#include "symbolic_core.h"
+#include "symbolic_digits.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+template <int Digits>
+struct DigitEngine {
+    static_assert(Digits >= 1 && Digits <= 8, "satu uint32_t memuat paling banyak 8 nibble");
+
+    static constexpr int BYTES = (Digits + 1) / 2;
+
+    // Posisi bit nibble digit ke-i dari kiri
+    static constexpr int shift(int i) { return 4 * (Digits - 1 - i); }
+    static constexpr uint32_t digitAt(uint32_t packed, int i) { return (packed >> shift(i)) & 0x0F; }
+
+    // Byte PackedDigits (dua digit per byte, nibble sisa 0) ke satu bilangan
+    static uint32_t load(const PackedDigits& digits) {
+        const uint8_t* bytes = digits.data();
+        uint32_t packed = 0;
+        for (int k = 0; k < BYTES; k++) packed = packed << 8 | bytes[k];
+        return (Digits & 1) ? packed >> 4 : packed;
+    }
+
+    static void store(uint32_t packed, PackedDigits& digits) {
+        if (digits.size() != static_cast<size_t>(Digits)) digits = PackedDigits(Digits);
+        uint8_t* bytes = digits.data();
+        if (Digits & 1) packed <<= 4;
+        for (int k = BYTES - 1; k >= 0; k--, packed >>= 8) bytes[k] = static_cast<uint8_t>(packed);
+    }
+
+    // Kode per nibble X=0, Y=1, G=2 seperti evaluatePacked: hijau dulu, lalu
+    // kuning dari kiri ke kanan selama digit target yang bukan hijau masih tersisa
+    static uint32_t evaluate(uint32_t target, uint32_t guess) {
+        return evaluate(target, guess, std::make_integer_sequence<int, Digits>());
+    }
+
+    static ArrowHint arrow(uint32_t target, uint32_t guess) {
+        if (guess == target) return ArrowHint::NONE;
+        return guess < target ? ArrowHint::UP : ArrowHint::DOWN;
+    }
+
+private:
+    template <int... I>
+    static uint32_t evaluate(uint32_t target, uint32_t guess, std::integer_sequence<int, I...>) {
+        const uint32_t diff = target ^ guess;
+        uint8_t remaining[16] = {};
+        // Fold dengan koma berjalan berurutan dari kiri, jadi kuning tetap diberikan dari kiri
+        ((remaining[digitAt(target, I)] += digitAt(diff, I) != 0), ...);
+        uint32_t result = 0;
+        (
+            [&] {
+                const uint32_t miss = digitAt(diff, I) != 0;
+                uint8_t& left = remaining[digitAt(guess, I)];
+                const uint32_t yellow = miss & (left != 0);
+                left = static_cast<uint8_t>(left - yellow);
+                result |= ((miss ^ 1) * 2 + yellow) << shift(I);
+            }(),
+            ...);
+        return result;
+    }
+};
+
+template <int Digits>
+ArrowHint evaluateFixed(const PackedDigits& target, const PackedDigits& guess, PackedDigits& result) {
+    using Engine = DigitEngine<Digits>;
+    const uint32_t t = Engine::load(target);
+    const uint32_t g = Engine::load(guess);
+    Engine::store(Engine::evaluate(t, g), result);
+    return Engine::arrow(t, g);
+}
+
+// Jalur umum untuk ukuran tanpa spesialisasi
+ArrowHint evaluateGeneric(const PackedDigits& target, const PackedDigits& guess, PackedDigits& result);
+
+/*
+ * PEMILIHAN SPESIALISASI
+ * visit menerima std::integral_constant<int, D> untuk 3-6 digit, atau
+ * D = 0 untuk ukuran lain (jalur umum).
+ */
+template <typename Visitor>
+decltype(auto) dispatchDigits(int digits, Visitor&& visit) {
+    switch (digits) {
+        case 3: return visit(std::integral_constant<int, 3>());
+        case 4: return visit(std::integral_constant<int, 4>());
+        case 5: return visit(std::integral_constant<int, 5>());
+        case 6: return visit(std::integral_constant<int, 6>());
+        default: return visit(std::integral_constant<int, 0>());
+    }
+}
+
+GuessEvaluator guessEvaluator(int digits);
+
+#endif
@@ -0,0 +1,291 @@
+#include "symbolic_feedback.h"
+#include "symbolic_feedback_simd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SYMBOLIC_HAVE_SSE2_KERNEL 1
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+using namespace feedback_detail;
+
+uint16_t feedbackCode(const string& result) {
+    uint16_t code = 0, weight = 1;
+    for (char c : result) {
+        if (c == 'G') code += 2 * weight;
+        else if (c == 'Y') code += weight;
+        weight *= 3;
+    }
+    return code;
+}
+
+string feedbackString(uint16_t code, int digits) {
+    string result(digits, 'X');
+    for (int i = 0; i < digits; i++) {
+        int trit = code % 3;
+        code /= 3;
+        if (trit == 2) result[i] = 'G';
+        else if (trit == 1) result[i] = 'Y';
+    }
+    return result;
+}
+
+uint16_t winningCode(int digits) {
+    uint16_t code = 0, weight = 1;
+    for (int i = 0; i < digits; i++, weight *= 3) code += 2 * weight;
+    return code;
+}
+
+// Histogram digit target yang bukan hijau, lalu kuning dari kiri ke kanan
+uint16_t evaluateGuessCode(const uint8_t* target, const uint8_t* guess, int digits) {
+    uint8_t counts[10] = {0};
+    uint32_t greenMask = 0;
+    for (int i = 0; i < digits; i++) {
+        if (target[i] == guess[i]) greenMask |= 1u << i;
+        else counts[target[i]]++;
+    }
+    uint16_t code = 0, weight = 1;
+    for (int i = 0; i < digits; i++, weight *= 3) {
+        if (greenMask & (1u << i)) {
+            code += 2 * weight;
+        } else if (counts[guess[i]] > 0) {
+            counts[guess[i]]--;
+            code += weight;
+        }
+    }
+    return code;
+}
+
+PackedCandidates PackedCandidates::fromRange(int numDigits, uint64_t begin, uint64_t end) {
+    PackedCandidates candidates(numDigits);
+    candidates.assignRange(begin, end - begin);
+    return candidates;
+}
+
+void PackedCandidates::clear() {
+    for (auto& plane : planes) plane.clear();
+}
+
+void PackedCandidates::reserve(size_t count) {
+    for (int p = 0; p < digits; p++) planes[p].reserve(count);
+}
+
+void PackedCandidates::push(uint64_t value) {
+    for (int p = digits - 1; p >= 0; p--) {
+        planes[p].push_back(static_cast<uint8_t>(value % 10));
+        value /= 10;
+    }
+}
+
+void PackedCandidates::resize(size_t count) {
+    for (int p = 0; p < digits; p++) planes[p].resize(count);
+}
+
+namespace {
+
+template <typename Word>
+void fillPlanes(vector<uint8_t>* planes, int digits, size_t begin, const uint64_t* values, size_t count) {
+    constexpr size_t BLOCK = 256;
+    Word rest[BLOCK];
+    for (size_t start = 0; start < count; start += BLOCK) {
+        size_t n = min(BLOCK, count - start);
+        for (size_t i = 0; i < n; i++) rest[i] = static_cast<Word>(values[start + i]);
+        for (int p = digits - 1; p >= 0; p--) {
+            uint8_t* out = planes[p].data() + begin + start;
+            for (size_t i = 0; i < n; i++) {
+                out[i] = static_cast<uint8_t>(rest[i] % 10);
+                rest[i] /= 10;
+            }
+        }
+    }
+}
+
+} // namespace
+
+void PackedCandidates::assign(size_t begin, const uint64_t* values, size_t count) {
+    // Per blok kecil, satu bidang digit sekali jalan supaya tulisan berurutan; 32 bit cukup
+    // untuk <= 9 digit dan pembagiannya jauh lebih murah
+    if (digits <= 9) {
+        fillPlanes<uint32_t>(planes, digits, begin, values, count);
+    } else {
+        fillPlanes<uint64_t>(planes, digits, begin, values, count);
+    }
+}
+
+void PackedCandidates::assignRange(uint64_t first, size_t count) {
+    resize(count);
+    // Per bidang: digit posisi p berganti setiap 10^(digits-1-p) angka, jadi cukup
+    // menulis deretan nilai yang sama (bidang terakhir berganti setiap angka)
+    uint64_t stride = 1;
+    for (int p = digits - 1; p >= 0; p--, stride *= 10) {
+        uint8_t* out = planes[p].data();
+        uint8_t digit = static_cast<uint8_t>(first / stride % 10);
+        if (stride == 1) {
+            for (size_t i = 0; i < count; i++) {
+                out[i] = digit;
+                digit = digit == 9 ? 0 : digit + 1;
+            }
+            continue;
+        }
+        uint64_t left = stride - first % stride;
+        for (size_t i = 0; i < count;) {
+            size_t run = static_cast<size_t>(min<uint64_t>(left, count - i));
+            memset(out + i, digit, run);
+            i += run;
+            left = stride;
+            digit = digit == 9 ? 0 : digit + 1;
+        }
+    }
+}
+
+void PackedCandidates::push(const string& number) {
+    for (int p = 0; p < digits; p++) planes[p].push_back(static_cast<uint8_t>(number[p] - '0'));
+}
+
+uint64_t PackedCandidates::value(size_t index) const {
+    uint64_t result = 0;
+    for (int p = 0; p < digits; p++) result = result * 10 + planes[p][index];
+    return result;
+}
+
+string PackedCandidates::toString(size_t index) const {
+    string number(digits, '0');
+    for (int p = 0; p < digits; p++) number[p] = static_cast<char>('0' + planes[p][index]);
+    return number;
+}
+
+namespace {
+
+#ifdef SYMBOLIC_HAVE_SSE2_KERNEL
+struct Sse2Ops {
+    using V = __m128i;
+    static constexpr size_t LANES = 8;
+    static V load(const uint8_t* p) {
+        return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128());
+    }
+    static void store(uint16_t* p, V v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static V set1(uint16_t x) { return _mm_set1_epi16(static_cast<short>(x)); }
+    static V zero() { return _mm_setzero_si128(); }
+    static V eq(V a, V b) { return _mm_cmpeq_epi16(a, b); }
+    static V cmpgt(V a, V b) { return _mm_cmpgt_epi16(a, b); }
+    static V and_(V a, V b) { return _mm_and_si128(a, b); }
+    static V andnot(V a, V b) { return _mm_andnot_si128(a, b); }
+    static V add(V a, V b) { return _mm_add_epi16(a, b); }
+    static V sub(V a, V b) { return _mm_sub_epi16(a, b); }
+};
+#endif
+
+enum class KernelPath { SCALAR, SSE2, AVX2 };
+
+KernelPath selectKernelPath() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if (avx2KernelCompiled() && __builtin_cpu_supports("avx2")) return KernelPath::AVX2;
+#endif
+#ifdef SYMBOLIC_HAVE_SSE2_KERNEL
+    return KernelPath::SSE2;
+#else
+    return KernelPath::SCALAR;
+#endif
+}
+
+bool kernelAvailable(KernelPath path) {
+    switch (path) {
+        case KernelPath::AVX2:
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            return avx2KernelCompiled() && __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+        case KernelPath::SSE2:
+#ifdef SYMBOLIC_HAVE_SSE2_KERNEL
+            return true;
+#else
+            return false;
+#endif
+        default: return true;
+    }
+}
+
+const char* kernelName(KernelPath path) {
+    switch (path) {
+        case KernelPath::AVX2: return "avx2";
+        case KernelPath::SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+// Dipilih sekali saat pertama dipakai; setFeedbackKernel boleh menggantinya
+atomic<KernelPath>& activeKernelPath() {
+    static atomic<KernelPath> path{selectKernelPath()};
+    return path;
+}
+
+KernelPath kernelPath() {
+    return activeKernelPath().load(memory_order_relaxed);
+}
+
+KernelGuess prepareGuess(const string& guess) {
+    KernelGuess g = {};
+    g.digits = static_cast<int>(guess.size());
+    uint16_t weight = 1;
+    for (int p = 0; p < g.digits; p++, weight *= 3) {
+        g.digit[p] = static_cast<uint8_t>(guess[p] - '0');
+        g.weight[p] = weight;
+        int s = 0;
+        while (s < g.slots && g.slotDigit[s] != g.digit[p]) s++;
+        if (s == g.slots) g.slotDigit[g.slots++] = g.digit[p];
+        g.slot[p] = static_cast<uint8_t>(s);
+    }
+    return g;
+}
+
+} // namespace
+
+void scoreGuessBatch(const string& guess, const PackedCandidates& candidates, size_t begin, size_t end,
+                     uint16_t* out) {
+    const KernelGuess g = prepareGuess(guess);
+    const uint8_t* planes[MAX_KERNEL_DIGITS];
+    for (int p = 0; p < g.digits; p++) planes[p] = candidates.plane(p);
+
+    size_t i = begin;
+    switch (kernelPath()) {
+        case KernelPath::AVX2: i = scoreBlocksAvx2(g, planes, begin, end, out); break;
+#ifdef SYMBOLIC_HAVE_SSE2_KERNEL
+        case KernelPath::SSE2: i = scoreBlocks<Sse2Ops>(g, planes, begin, end, out); break;
+#endif
+        default: break;
+    }
+
+    // Sisa yang tidak memenuhi satu vektor penuh
+    uint8_t target[MAX_KERNEL_DIGITS];
+    for (; i < end; i++) {
+        for (int p = 0; p < g.digits; p++) target[p] = planes[p][i];
+        out[i - begin] = evaluateGuessCode(target, g.digit, g.digits);
+    }
+}
+
+const char* feedbackKernelName() {
+    return kernelName(kernelPath());
+}
+
+vector<string> feedbackKernelNames() {
+    vector<string> names;
+    for (KernelPath path : {KernelPath::AVX2, KernelPath::SSE2, KernelPath::SCALAR}) {
+        if (kernelAvailable(path)) names.push_back(kernelName(path));
+    }
+    return names;
+}
+
+bool setFeedbackKernel(const string& name) {
+    for (KernelPath path : {KernelPath::AVX2, KernelPath::SSE2, KernelPath::SCALAR}) {
+        if (name != kernelName(path)) continue;
+        if (!kernelAvailable(path)) return false;
+        activeKernelPath().store(path, memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,78 @@
+/*
+ * SYMBOLIC NUMBLER - KERNEL UMPAN BALIK MASSAL
+ *
+ * Menilai satu tebakan terhadap banyak kandidat sekaligus (SSE2/AVX2 dengan
+ * cadangan skalar). Hasilnya identik bit demi bit dengan evaluateGuess,
+ * termasuk penanganan digit ganda.
+ *
+ * Kode umpan balik: X=0, Y=1, G=2 per posisi, posisi i (dari kiri)
+ * berbobot 3^i. Muat di uint16_t sampai 10 digit.
+ */
+#ifndef SYMBOLIC_FEEDBACK_H
+#define SYMBOLIC_FEEDBACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+constexpr int MAX_KERNEL_DIGITS = 10;
+
+// Konversi antara string hasil (G/Y/X) dan kode basis-3
+uint16_t feedbackCode(const std::string& result);
+std::string feedbackString(uint16_t code, int digits);
+
+// Kode untuk tebakan "semua hijau"
+uint16_t winningCode(int digits);
+
+// Evaluasi skalar O(n) satu pasangan, digit bernilai 0-9 (bukan karakter)
+uint16_t evaluateGuessCode(const uint8_t* target, const uint8_t* guess, int digits);
+
+/*
+ * KANDIDAT TERKEMAS (STRUCTURE OF ARRAYS)
+ * plane(p)[i] adalah digit posisi p dari kandidat ke-i.
+ */
+class PackedCandidates {
+private:
+    int digits;
+    std::vector<uint8_t> planes[MAX_KERNEL_DIGITS];
+
+public:
+    explicit PackedCandidates(int numDigits = 4) : digits(numDigits) {}
+
+    // Semua angka dalam [begin, end) berurutan
+    static PackedCandidates fromRange(int numDigits, uint64_t begin, uint64_t end);
+
+    void clear();
+    void reserve(size_t count);
+    void push(uint64_t value);
+    void push(const std::string& number);
+
+    // Mengubah jumlah kandidat lalu mengisi slot [begin, begin + count) (aman dari banyak thread untuk slot berbeda)
+    void resize(size_t count);
+    void assign(size_t begin, const uint64_t* values, size_t count);
+
+    // Mengganti isi dengan count angka berurutan mulai dari first (tanpa pembagian per angka)
+    void assignRange(uint64_t first, size_t count);
+
+    int getDigits() const { return digits; }
+    size_t size() const { return planes[0].size(); }
+    const uint8_t* plane(int pos) const { return planes[pos].data(); }
+    uint64_t value(size_t index) const;
+    std::string toString(size_t index) const;
+};
+
+// Mengisi out[i - begin] dengan kode umpan balik tebakan terhadap kandidat i
+void scoreGuessBatch(const std::string& guess, const PackedCandidates& candidates,
+                     size_t begin, size_t end, uint16_t* out);
+
+// Nama jalur yang dipilih saat runtime: "avx2", "sse2" atau "scalar"
+const char* feedbackKernelName();
+
+// Semua jalur yang bisa dijalankan mesin ini, terbaik dulu
+std::vector<std::string> feedbackKernelNames();
+
+// Memaksa satu jalur (verifikasi dan bench); false jika tidak tersedia di mesin ini
+bool setFeedbackKernel(const std::string& name);
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Jalur AVX2 kernel umpan balik. Hanya kode di file ini yang dikompilasi
+ * dengan target avx2; pemilihan jalurnya terjadi saat runtime di
+ * symbolic_feedback.cpp sehingga aman di CPU tanpa AVX2.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SYMBOLIC_HAVE_AVX2_KERNEL 1
+// Header standar di-include sebelum pragma agar fungsi inline-nya tidak ikut AVX2
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#include <immintrin.h>
+#endif
+
+#include "symbolic_feedback_simd.h"
+
+namespace feedback_detail {
+
+#ifdef SYMBOLIC_HAVE_AVX2_KERNEL
+
+namespace {
+
+struct Avx2Ops {
+    using V = __m256i;
+    static constexpr size_t LANES = 16;
+    static V load(const uint8_t* p) {
+        return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+    static void store(uint16_t* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static V set1(uint16_t x) { return _mm256_set1_epi16(static_cast<short>(x)); }
+    static V zero() { return _mm256_setzero_si256(); }
+    static V eq(V a, V b) { return _mm256_cmpeq_epi16(a, b); }
+    static V cmpgt(V a, V b) { return _mm256_cmpgt_epi16(a, b); }
+    static V and_(V a, V b) { return _mm256_and_si256(a, b); }
+    static V andnot(V a, V b) { return _mm256_andnot_si256(a, b); }
+    static V add(V a, V b) { return _mm256_add_epi16(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_epi16(a, b); }
+};
+
+} // namespace
+
+bool avx2KernelCompiled() { return true; }
+
+size_t scoreBlocksAvx2(const KernelGuess& g, const uint8_t* const* planes, size_t begin, size_t end,
+                       uint16_t* out) {
+    return scoreBlocks<Avx2Ops>(g, planes, begin, end, out);
+}
+
+#else
+
+bool avx2KernelCompiled() { return false; }
+
+size_t scoreBlocksAvx2(const KernelGuess&, const uint8_t* const*, size_t begin, size_t, uint16_t*) {
+    return begin;
+}
+
+#endif
+
+} // namespace feedback_detail
+
+#ifdef SYMBOLIC_HAVE_AVX2_KERNEL
+#pragma GCC pop_options
+#endif
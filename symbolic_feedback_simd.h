@@ -0,0 +1,80 @@
+/*
+ * SYMBOLIC NUMBLER - KERNEL UMPAN BALIK GENERIK (INTERNAL)
+ *
+ * Satu implementasi untuk semua lebar vektor. Ops menyediakan operasi
+ * lajur 16-bit (SSE2: 8 lajur, AVX2: 16 lajur). Hanya di-include oleh
+ * symbolic_feedback.cpp dan symbolic_feedback_avx2.cpp.
+ */
+#ifndef SYMBOLIC_FEEDBACK_SIMD_H
+#define SYMBOLIC_FEEDBACK_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace feedback_detail {
+
+// Tebakan yang sudah diurai: digit, bobot 3^i dan slot digit unik
+struct KernelGuess {
+    int digits;
+    int slots;
+    uint8_t digit[10];
+    uint8_t slot[10];
+    uint8_t slotDigit[10];
+    uint16_t weight[10];
+};
+
+/*
+ * Hijau: digit sama di posisi sama.
+ * Kuning: posisi i (bukan hijau, digit d) kuning jika jumlah posisi bukan-hijau
+ * sebelumnya dengan digit d masih kurang dari jumlah d di target yang bukan hijau.
+ * Ini sama persis dengan pencarian "target pertama yang belum terpakai".
+ *
+ * Mengembalikan indeks pertama yang belum diproses (sisa untuk jalur skalar).
+ */
+template <class Ops>
+size_t scoreBlocks(const KernelGuess& g, const uint8_t* const* planes, size_t begin, size_t end,
+                   uint16_t* out) {
+    using V = typename Ops::V;
+    size_t i = begin;
+    for (; i + Ops::LANES <= end; i += Ops::LANES) {
+        V target[10], green[10];
+        for (int p = 0; p < g.digits; p++) {
+            target[p] = Ops::load(planes[p] + i);
+            green[p] = Ops::eq(target[p], Ops::set1(g.digit[p]));
+        }
+
+        // Jumlah setiap digit tebakan di posisi target yang bukan hijau (mask = -1)
+        V targetCount[10];
+        for (int s = 0; s < g.slots; s++) {
+            V count = Ops::zero();
+            V digit = Ops::set1(g.slotDigit[s]);
+            for (int p = 0; p < g.digits; p++) {
+                count = Ops::sub(count, Ops::andnot(green[p], Ops::eq(target[p], digit)));
+            }
+            targetCount[s] = count;
+        }
+
+        V prior[10];
+        for (int s = 0; s < g.slots; s++) prior[s] = Ops::zero();
+        V code = Ops::zero();
+        for (int p = 0; p < g.digits; p++) {
+            int s = g.slot[p];
+            V notGreen = Ops::andnot(green[p], Ops::set1(0xFFFF));
+            V yellow = Ops::and_(notGreen, Ops::cmpgt(targetCount[s], prior[s]));
+            prior[s] = Ops::sub(prior[s], notGreen);
+            code = Ops::add(code, Ops::and_(green[p], Ops::set1(static_cast<uint16_t>(2 * g.weight[p]))));
+            code = Ops::add(code, Ops::and_(yellow, Ops::set1(g.weight[p])));
+        }
+        Ops::store(out + (i - begin), code);
+    }
+    return i;
+}
+
+// Jalur AVX2 (didefinisikan di symbolic_feedback_avx2.cpp), 0 jika tidak dikompilasi
+bool avx2KernelCompiled();
+size_t scoreBlocksAvx2(const KernelGuess& g, const uint8_t* const* planes, size_t begin, size_t end,
+                       uint16_t* out);
+
+} // namespace feedback_detail
+
+#endif
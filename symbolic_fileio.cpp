@@ -0,0 +1,91 @@
+#include "symbolic_fileio.h"
+
+#include <cstdio>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+#ifdef _WIN32
+int openFile(const string& path, bool append) {
+    int flags = _O_RDWR | _O_CREAT | _O_BINARY | (append ? _O_APPEND : _O_TRUNC);
+    return _open(path.c_str(), flags, _S_IREAD | _S_IWRITE);
+}
+void closeFile(int fd) { _close(fd); }
+bool lockFile(int) { return true; }
+bool sameFile(int, const string&) { return true; }
+long long fileSize(int fd) { return _filelengthi64(fd); }
+bool truncateFile(int fd, long long size) { return _chsize_s(fd, size) == 0; }
+bool syncFile(int fd) { return _commit(fd) == 0; }
+bool writeFile(int fd, const void* data, size_t size) {
+    return _write(fd, data, static_cast<unsigned>(size)) == static_cast<int>(size);
+}
+bool readFileAt(int fd, long long offset, void* data, size_t size) {
+    if (_lseeki64(fd, offset, SEEK_SET) < 0) return false;
+    return _read(fd, data, static_cast<unsigned>(size)) == static_cast<int>(size);
+}
+bool replaceFile(const string& from, const string& to) {
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+}
+#else
+int openFile(const string& path, bool append) {
+    int flags = O_RDWR | O_CREAT | (append ? O_APPEND : O_TRUNC);
+    return ::open(path.c_str(), flags, 0644);
+}
+void closeFile(int fd) { ::close(fd); }
+bool lockFile(int fd) {
+    while (flock(fd, LOCK_EX) < 0) {
+        if (errno != EINTR) return false;
+    }
+    return true;
+}
+// File bisa sudah diganti (rename) oleh proses lain yang sedang memadatkan
+bool sameFile(int fd, const string& path) {
+    struct stat opened, current;
+    if (fstat(fd, &opened) < 0 || stat(path.c_str(), &current) < 0) return false;
+    return opened.st_dev == current.st_dev && opened.st_ino == current.st_ino;
+}
+long long fileSize(int fd) {
+    struct stat info;
+    return fstat(fd, &info) < 0 ? -1 : static_cast<long long>(info.st_size);
+}
+bool truncateFile(int fd, long long size) { return ftruncate(fd, size) == 0; }
+bool syncFile(int fd) { return fsync(fd) == 0; }
+bool writeFile(int fd, const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = ::write(fd, bytes, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        bytes += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+bool readFileAt(int fd, long long offset, void* data, size_t size) {
+    char* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t n = ::pread(fd, bytes, size, static_cast<off_t>(offset));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        bytes += n;
+        offset += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+bool replaceFile(const string& from, const string& to) { return rename(from.c_str(), to.c_str()) == 0; }
+#endif
@@ -0,0 +1,54 @@
+/*
+ * SYMBOLIC NUMBLER - OPERASI FILE BIASA PER PLATFORM
+ *
+ * Pembungkus tipis di atas descriptor file untuk log hanya-tambah:
+ * tulis penuh, fsync, potong, rename atomik dan flock antar proses.
+ * Di Windows tidak ada flock dan rename tidak bisa menimpa file terbuka,
+ * jadi penguncian antar proses hanya tersedia di POSIX.
+ */
+#ifndef SYMBOLIC_FILEIO_H
+#define SYMBOLIC_FILEIO_H
+
+#include <cstddef>
+#include <string>
+
+// append: O_APPEND, selain itu file dikosongkan (O_TRUNC)
+int openFile(const std::string& path, bool append);
+void closeFile(int fd);
+bool lockFile(int fd);
+bool sameFile(int fd, const std::string& path); // false jika path sudah diganti lewat rename
+long long fileSize(int fd);
+bool truncateFile(int fd, long long size);
+bool syncFile(int fd);
+bool writeFile(int fd, const void* data, size_t size);
+bool readFileAt(int fd, long long offset, void* data, size_t size); // false jika kurang dari size byte
+bool replaceFile(const std::string& from, const std::string& to);
+
+// Membuka log dengan kunci eksklusif; kunci dilepas saat objek hancur
+class LockedLog {
+private:
+    int fd = -1;
+
+public:
+    LockedLog() = default;
+    ~LockedLog() {
+        if (fd >= 0) closeFile(fd); // Menutup descriptor juga melepas flock
+    }
+    LockedLog(const LockedLog&) = delete;
+    LockedLog& operator=(const LockedLog&) = delete;
+
+    bool open(const std::string& path) {
+        while (true) {
+            fd = openFile(path, true);
+            if (fd < 0) return false;
+            if (!lockFile(fd)) return false;
+            if (sameFile(fd, path)) return true;
+            closeFile(fd);
+            fd = -1;
+        }
+    }
+
+    int get() const { return fd; }
+};
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * SYMBOLIC NUMBLER - ATLAS GLIF SAAT KOMPILASI
+ *
+ * Seni ASCII digit dan panah diurai menjadi tabel baris berukuran tetap
+ * oleh fungsi constexpr. Papan menyalin baris mentah (GlyphFont::row)
+ * langsung ke sel ScreenLine dengan warna sel yang dipilih per digit, jadi
+ * tidak ada kode warna di atlas, tanpa alokasi dan tanpa parsing runtime.
+ */
+#ifndef SYMBOLIC_GLYPHS_H
+#define SYMBOLIC_GLYPHS_H
+
+#include <cstddef>
+#include <string_view>
+
+// Warna satu glif; papan memetakannya ke warna sel layar
+enum GlyphColor {
+    GLYPH_PLAIN,
+    GLYPH_GREEN,
+    GLYPH_YELLOW,
+    GLYPH_RED,
+    GLYPH_MAGENTA,
+    GLYPH_CYAN,
+    GLYPH_COLOR_COUNT
+};
+
+// Indeks glif pada atlas digit: 0-9 lalu kotak kosong untuk input
+constexpr int GLYPH_PLACEHOLDER = 10;
+constexpr int DIGIT_GLYPH_COUNT = 11;
+
+// Indeks glif pada atlas panah
+constexpr int GLYPH_ARROW_UP = 0;
+constexpr int GLYPH_ARROW_DOWN = 1;
+constexpr int ARROW_GLYPH_COUNT = 2;
+
+template <size_t Count, size_t Rows, size_t Width>
+struct GlyphAtlas {
+    char art[Count][Rows][Width] = {};
+};
+
+// Memeriksa saat kompilasi bahwa setiap glif tepat Rows baris x Width kolom
+template <size_t Count>
+constexpr bool glyphSourceValid(const char* const (&source)[Count], size_t rows, size_t width) {
+    for (size_t g = 0; g < Count; g++) {
+        const char* p = source[g];
+        for (size_t r = 0; r < rows; r++) {
+            size_t w = 0;
+            while (*p != '\0' && *p != '\n') {
+                p++;
+                w++;
+            }
+            if (w != width) return false;
+            if (r + 1 < rows && *p++ != '\n') return false;
+        }
+        if (*p != '\0') return false;
+    }
+    return true;
+}
+
+// Mengurai seni "baris\nbaris\n..." menjadi tabel baris
+template <size_t Count, size_t Rows, size_t Width>
+constexpr GlyphAtlas<Count, Rows, Width> buildGlyphAtlas(const char* const (&source)[Count]) {
+    GlyphAtlas<Count, Rows, Width> atlas{};
+    for (size_t g = 0; g < Count; g++) {
+        const char* p = source[g];
+        for (size_t r = 0; r < Rows; r++) {
+            for (size_t c = 0; c < Width; c++) atlas.art[g][r][c] = *p++;
+            if (*p == '\n') p++;
+        }
+    }
+    return atlas;
+}
+
+/*
+ * PANDANGAN FONT (TANPA TEMPLATE)
+ * Menunjuk ke atlas constexpr sehingga renderer bisa memilih ukuran glif saat runtime.
+ */
+struct GlyphFont {
+    int rows;
+    int width;
+    const char* art;
+    int count;
+
+    // Baris mentah tanpa warna; warnanya diberikan sel tujuan
+    std::string_view row(int glyph, int r) const {
+        return std::string_view(art + (static_cast<size_t>(glyph) * rows + r) * width, width);
+    }
+};
+
+template <size_t Count, size_t Rows, size_t Width>
+constexpr GlyphFont glyphFont(const GlyphAtlas<Count, Rows, Width>& atlas) {
+    return GlyphFont{static_cast<int>(Rows), static_cast<int>(Width), &atlas.art[0][0][0], static_cast<int>(Count)};
+}
+
+/*
+ * SENI ASCII
+ */
+namespace glyph_art {
+
+// Digit besar 7 baris
+constexpr const char* LARGE_DIGITS[DIGIT_GLYPH_COUNT] = {
+    " ##### \n##   ##\n##   ##\n##   ##\n##   ##\n##   ##\n ##### ",
+    "   ##  \n ####  \n   ##  \n   ##  \n   ##  \n   ##  \n#######",
+    " ##### \n##   ##\n     ##\n ##### \n##     \n##     \n#######",
+    " ##### \n##   ##\n     ##\n ##### \n     ##\n##   ##\n ##### ",
+    "##   ##\n##   ##\n##   ##\n#######\n     ##\n     ##\n     ##",
+    "#######\n##     \n##     \n###### \n     ##\n##   ##\n ##### ",
+    " ##### \n##   ##\n##     \n###### \n##   ##\n##   ##\n ##### ",
+    "#######\n     ##\n    ## \n   ##  \n  ##   \n ##    \n ##    ",
+    " ##### \n##   ##\n##   ##\n ##### \n##   ##\n##   ##\n ##### ",
+    " ##### \n##   ##\n##   ##\n ######\n     ##\n##   ##\n ##### ",
+    " _____ \n _____ \n _____ \n _____ \n _____ \n _____ \n _____ "};
+
+constexpr const char* LARGE_ARROWS[ARROW_GLYPH_COUNT] = {
+    "   ##   \n"
+    "  ####  \n"
+    " ###### \n"
+    "   ##   \n"
+    "   ##   \n"
+    "   ##   \n"
+    "   ##   ",
+    "   ##   \n"
+    "   ##   \n"
+    "   ##   \n"
+    "   ##   \n"
+    " ###### \n"
+    "  ####  \n"
+    "   ##   "};
+
+// Digit ringkas 3 baris (gaya tujuh segmen) untuk terminal sempit
+constexpr const char* COMPACT_DIGITS[DIGIT_GLYPH_COUNT] = {
+    " _ \n| |\n|_|", "   \n  |\n  |", " _ \n _|\n|_ ", " _ \n _|\n _|", "   \n|_|\n  |",
+    " _ \n|_ \n _|", " _ \n|_ \n|_|", " _ \n  |\n  |", " _ \n|_|\n|_|", " _ \n|_|\n _|",
+    "   \n   \n _ "};
+
+constexpr const char* COMPACT_ARROWS[ARROW_GLYPH_COUNT] = {
+    " ^ \n/|\\\n | ",
+    " | \n\\|/\n v "};
+
+// Digit satu karakter untuk mode maraton (ratusan digit per baris layar)
+constexpr const char* TINY_DIGITS[DIGIT_GLYPH_COUNT] = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "_"};
+
+constexpr const char* TINY_ARROWS[ARROW_GLYPH_COUNT] = {"^", "v"};
+
+static_assert(glyphSourceValid(LARGE_DIGITS, 7, 7), "digit besar harus 7x7");
+static_assert(glyphSourceValid(LARGE_ARROWS, 7, 8), "panah besar harus 7x8");
+static_assert(glyphSourceValid(COMPACT_DIGITS, 3, 3), "digit ringkas harus 3x3");
+static_assert(glyphSourceValid(COMPACT_ARROWS, 3, 3), "panah ringkas harus 3x3");
+static_assert(glyphSourceValid(TINY_DIGITS, 1, 1), "digit mini harus 1x1");
+static_assert(glyphSourceValid(TINY_ARROWS, 1, 1), "panah mini harus 1x1");
+
+} // namespace glyph_art
+
+inline constexpr auto LARGE_DIGIT_ATLAS = buildGlyphAtlas<DIGIT_GLYPH_COUNT, 7, 7>(glyph_art::LARGE_DIGITS);
+inline constexpr auto LARGE_ARROW_ATLAS = buildGlyphAtlas<ARROW_GLYPH_COUNT, 7, 8>(glyph_art::LARGE_ARROWS);
+inline constexpr auto COMPACT_DIGIT_ATLAS = buildGlyphAtlas<DIGIT_GLYPH_COUNT, 3, 3>(glyph_art::COMPACT_DIGITS);
+inline constexpr auto COMPACT_ARROW_ATLAS = buildGlyphAtlas<ARROW_GLYPH_COUNT, 3, 3>(glyph_art::COMPACT_ARROWS);
+inline constexpr auto TINY_DIGIT_ATLAS = buildGlyphAtlas<DIGIT_GLYPH_COUNT, 1, 1>(glyph_art::TINY_DIGITS);
+inline constexpr auto TINY_ARROW_ATLAS = buildGlyphAtlas<ARROW_GLYPH_COUNT, 1, 1>(glyph_art::TINY_ARROWS);
+
+// Pasangan font digit dan panah dengan tinggi yang sama
+struct GlyphStyle {
+    const char* name;
+    GlyphFont digits;
+    GlyphFont arrows;
+};
+
+inline constexpr GlyphStyle LARGE_GLYPHS = {"besar", glyphFont(LARGE_DIGIT_ATLAS), glyphFont(LARGE_ARROW_ATLAS)};
+inline constexpr GlyphStyle COMPACT_GLYPHS = {"ringkas", glyphFont(COMPACT_DIGIT_ATLAS), glyphFont(COMPACT_ARROW_ATLAS)};
+inline constexpr GlyphStyle TINY_GLYPHS = {"mini", glyphFont(TINY_DIGIT_ATLAS), glyphFont(TINY_ARROW_ATLAS)};
+
+#endif
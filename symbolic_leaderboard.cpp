@@ -0,0 +1,333 @@
+#include "symbolic_leaderboard.h"
+#include "symbolic_alloc.h"
+#include "symbolic_crc32.h"
+#include "symbolic_fileio.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+using namespace std;
+
+namespace {
+
+constexpr char LOG_MAGIC[8] = {'S', 'Y', 'M', 'L', 'B', 'L', 'O', 'G'};
+constexpr char INDEX_MAGIC[8] = {'S', 'Y', 'M', 'L', 'B', 'I', 'D', 'X'};
+constexpr uint32_t LOG_VERSION = 1;
+
+struct LogHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint64_t generation;
+    uint64_t reserved;
+};
+
+struct IndexHeader {
+    char magic[8];
+    uint64_t generation;
+    uint64_t coveredRecords;
+    uint64_t count;
+};
+
+static_assert(sizeof(LogHeader) == 32 && sizeof(IndexHeader) == 32, "header harus 32 byte");
+
+uint32_t recordChecksum(const ScoreRecord& record) {
+    return crc32(&record, offsetof(ScoreRecord, checksum));
+}
+
+uint64_t newGeneration() {
+    random_device rd;
+    uint64_t clock = static_cast<uint64_t>(chrono::steady_clock::now().time_since_epoch().count());
+    return (static_cast<uint64_t>(rd()) << 32) ^ rd() ^ clock;
+}
+
+} // namespace
+
+LeaderboardStore::LeaderboardStore(const string& path) : logPath(path) {
+    size_t dot = path.rfind('.');
+    indexPath = (dot == string::npos ? path : path.substr(0, dot)) + ".idx";
+}
+
+const ScoreRecord* LeaderboardStore::recordAt(size_t recordNumber) const {
+    return reinterpret_cast<const ScoreRecord*>(log.data() + sizeof(LogHeader)) + recordNumber;
+}
+
+bool LeaderboardStore::recordValid(size_t recordNumber) const {
+    if (recordNumber >= records) return false;
+    const ScoreRecord* record = recordAt(recordNumber);
+    return record->checksum == recordChecksum(*record);
+}
+
+// Skor lebih tinggi dulu; skor sama diurutkan menurut waktu masuk
+bool LeaderboardStore::ranksBefore(uint32_t a, uint32_t b) const {
+    int32_t scoreA = recordAt(a)->score, scoreB = recordAt(b)->score;
+    if (scoreA != scoreB) return scoreA > scoreB;
+    return a < b;
+}
+
+ScoreEntry LeaderboardStore::entryAt(size_t recordNumber) const {
+    const ScoreRecord* record = recordAt(recordNumber);
+    ScoreEntry entry;
+    entry.playerName.assign(record->name, strnlen(record->name, sizeof record->name));
+    entry.score = record->score;
+    entry.digits = record->digits;
+    entry.attempts = record->attempts;
+    entry.timestamp = record->timestamp;
+    entry.elapsedMs = record->elapsedMs;
+    return entry;
+}
+
+bool LeaderboardStore::mapLog() {
+    records = 0;
+    generation = 0;
+    if (!log.open(logPath)) return false;
+    if (log.size() < sizeof(LogHeader)) return true;
+
+    const LogHeader* header = reinterpret_cast<const LogHeader*>(log.data());
+    if (memcmp(header->magic, LOG_MAGIC, sizeof LOG_MAGIC) != 0 || header->recordSize != sizeof(ScoreRecord)) {
+        return true;
+    }
+    generation = header->generation;
+    // Rekaman terakhir yang terpotong (penulis crash) diabaikan
+    records = (log.size() - sizeof(LogHeader)) / sizeof(ScoreRecord);
+    return true;
+}
+
+void LeaderboardStore::mapIndex() {
+    indexed = nullptr;
+    indexedCount = 0;
+    coveredRecords = 0;
+    if (!index.open(indexPath) || index.size() < sizeof(IndexHeader)) return;
+
+    const IndexHeader* header = reinterpret_cast<const IndexHeader*>(index.data());
+    bool valid = memcmp(header->magic, INDEX_MAGIC, sizeof INDEX_MAGIC) == 0 && header->generation == generation &&
+                 header->coveredRecords <= records &&
+                 index.size() == sizeof(IndexHeader) + header->count * sizeof(uint32_t);
+    if (!valid) return; // Indeks usang atau dari log lain: dibangun ulang saat pemadatan
+
+    indexed = reinterpret_cast<const uint32_t*>(index.data() + sizeof(IndexHeader));
+    indexedCount = header->count;
+    coveredRecords = header->coveredRecords;
+}
+
+void LeaderboardStore::scanTail(size_t from) {
+    tail.clear();
+    invalidRecords = 0;
+    for (size_t i = from; i < records; i++) {
+        if (recordValid(i)) tail.push_back(static_cast<uint32_t>(i));
+        else invalidRecords++;
+    }
+    sort(tail.begin(), tail.end(), [this](uint32_t a, uint32_t b) { return ranksBefore(a, b); });
+}
+
+bool LeaderboardStore::refresh() {
+    SYMBOLIC_ALLOC_SCOPE(AllocPhase::LEADERBOARD);
+    bool exists = mapLog();
+    mapIndex();
+    scanTail(coveredRecords);
+    return exists;
+}
+
+bool LeaderboardStore::load(const string& legacyTextPath) {
+    SYMBOLIC_ALLOC_SCOPE(AllocPhase::LEADERBOARD);
+    if (!refresh() && !legacyTextPath.empty()) {
+        // Migrasi satu kali dari format teks lama
+        ifstream file(legacyTextPath);
+        vector<ScoreEntry> entries;
+        ScoreEntry entry;
+        while (file >> entry.playerName >> entry.score >> entry.digits >> entry.attempts) entries.push_back(entry);
+        if (!add(entries)) return false;
+        refresh();
+    }
+    if (tail.size() > COMPACT_THRESHOLD || invalidRecords > 0) compact();
+    return true;
+}
+
+bool LeaderboardStore::add(const ScoreEntry& entry) {
+    return append(&entry, 1);
+}
+
+bool LeaderboardStore::add(const vector<ScoreEntry>& entries) {
+    return entries.empty() || append(entries.data(), entries.size());
+}
+
+bool LeaderboardStore::append(const ScoreEntry* entries, size_t count) {
+    SYMBOLIC_ALLOC_SCOPE(AllocPhase::LEADERBOARD);
+    {
+        LockedLog file;
+        if (!file.open(logPath)) return false;
+        int fd = file.get();
+
+        long long size = fileSize(fd);
+        if (size < 0) return false;
+        if (size < static_cast<long long>(sizeof(LogHeader))) {
+            // File baru (atau header belum lengkap): tulis header
+            LogHeader header = {};
+            memcpy(header.magic, LOG_MAGIC, sizeof LOG_MAGIC);
+            header.version = LOG_VERSION;
+            header.recordSize = sizeof(ScoreRecord);
+            header.generation = newGeneration();
+            if (!truncateFile(fd, 0) || !writeFile(fd, &header, sizeof header)) return false;
+        } else {
+            if (!log.isOpen() || generation == 0) mapLog();
+            if (generation == 0) return false; // Bukan log papan peringkat: jangan ditimpa
+            // Potongan rekaman dari penulis yang crash dibuang agar rekaman tetap sejajar
+            long long body = size - static_cast<long long>(sizeof(LogHeader));
+            long long aligned = body - body % static_cast<long long>(sizeof(ScoreRecord));
+            if (aligned != body && !truncateFile(fd, sizeof(LogHeader) + aligned)) return false;
+        }
+
+        int64_t now = chrono::duration_cast<chrono::seconds>(chrono::system_clock::now().time_since_epoch()).count();
+        vector<ScoreRecord> batch(count);
+        for (size_t i = 0; i < count; i++) {
+            const ScoreEntry& entry = entries[i];
+            ScoreRecord& record = batch[i];
+            strncpy(record.name, entry.playerName.c_str(), sizeof record.name - 1);
+            record.score = entry.score;
+            record.digits = entry.digits;
+            record.attempts = entry.attempts;
+            record.timestamp = entry.timestamp ? entry.timestamp : now;
+            record.elapsedMs = entry.elapsedMs;
+            record.checksum = recordChecksum(record);
+        }
+        // Satu write dan satu fsync untuk seluruh kelompok
+        if (!writeFile(fd, batch.data(), count * sizeof(ScoreRecord)) || !syncFile(fd)) return false;
+    }
+
+    refresh();
+    if (tail.size() > COMPACT_THRESHOLD) compact();
+    return true;
+}
+
+bool LeaderboardStore::writeIndex(const vector<uint32_t>& order) {
+    string tempPath = indexPath + ".tmp";
+    int fd = openFile(tempPath, false);
+    if (fd < 0) return false;
+
+    IndexHeader header = {};
+    memcpy(header.magic, INDEX_MAGIC, sizeof INDEX_MAGIC);
+    header.generation = generation;
+    header.coveredRecords = records;
+    header.count = order.size();
+    bool ok = writeFile(fd, &header, sizeof header) &&
+              writeFile(fd, order.data(), order.size() * sizeof(uint32_t)) && syncFile(fd);
+    closeFile(fd);
+    return ok && replaceFile(tempPath, indexPath);
+}
+
+// Menyalin hanya rekaman yang sah ke log baru dengan generasi baru
+bool LeaderboardStore::rewriteLog() {
+    string tempPath = logPath + ".tmp";
+    int fd = openFile(tempPath, false);
+    if (fd < 0) return false;
+
+    LogHeader header = {};
+    memcpy(header.magic, LOG_MAGIC, sizeof LOG_MAGIC);
+    header.version = LOG_VERSION;
+    header.recordSize = sizeof(ScoreRecord);
+    header.generation = newGeneration();
+    bool ok = writeFile(fd, &header, sizeof header);
+
+    vector<ScoreRecord> buffer;
+    buffer.reserve(1024);
+    for (size_t i = 0; ok && i < records; i++) {
+        if (recordValid(i)) buffer.push_back(*recordAt(i));
+        if (buffer.size() == buffer.capacity() || i + 1 == records) {
+            ok = writeFile(fd, buffer.data(), buffer.size() * sizeof(ScoreRecord));
+            buffer.clear();
+        }
+    }
+    ok = ok && syncFile(fd);
+    closeFile(fd);
+    return ok && replaceFile(tempPath, logPath);
+}
+
+bool LeaderboardStore::compact() {
+    LockedLog file;
+    if (!file.open(logPath)) return false;
+
+    // Di bawah kunci: lihat semua rekaman yang sudah ditulis proses lain
+    refresh();
+    if (records == 0) return true;
+    // Pemeriksaan penuh: rekaman yang sudah terindeks pun bisa rusak di disk
+    size_t damaged = 0;
+    for (size_t i = 0; i < records; i++) {
+        if (!recordValid(i)) damaged++;
+    }
+    if (damaged > 0) {
+        if (!rewriteLog()) return false;
+        refresh();
+    }
+
+    vector<uint32_t> order;
+    order.reserve(indexedCount + tail.size());
+    if (indexed != nullptr) {
+        auto before = [this](uint32_t a, uint32_t b) { return ranksBefore(a, b); };
+        merge(indexed, indexed + indexedCount, tail.begin(), tail.end(), back_inserter(order), before);
+    } else {
+        order = tail; // Tanpa indeks sah, tail sudah berisi semua rekaman terurut
+    }
+    if (!writeIndex(order)) return false;
+    refresh();
+    return true;
+}
+
+vector<ScoreEntry> LeaderboardStore::top(size_t n) const {
+    vector<ScoreEntry> entries;
+    size_t i = 0, j = 0;
+    while (entries.size() < n && (i < indexedCount || j < tail.size())) {
+        uint32_t next;
+        if (j == tail.size() || (i < indexedCount && ranksBefore(indexed[i], tail[j]))) next = indexed[i++];
+        else next = tail[j++];
+        if (recordValid(next)) entries.push_back(entryAt(next));
+    }
+    return entries;
+}
+
+const ScoreRanking& LeaderboardStore::rankings() {
+    ranking.update(*this);
+    return ranking;
+}
+
+namespace {
+
+string describeRank(const RankInfo& info) {
+    char percentile[16];
+    snprintf(percentile, sizeof percentile, "%.1f", info.percentile);
+    return "#" + to_string(info.rank) + " dari " + to_string(info.total) + " (persentil " + percentile + ")";
+}
+
+} // namespace
+
+LeaderboardView leaderboardView(LeaderboardStore& store, RankingKey key, size_t rows, const RankingQuery& query) {
+    SYMBOLIC_ALLOC_SCOPE(AllocPhase::LEADERBOARD);
+    const ScoreRanking& ranking = store.rankings();
+    LeaderboardView view;
+    view.title = "PAPAN PERINGKAT";
+    if (key.digits > 0) view.title += " - " + to_string(key.digits) + " DIGIT";
+    if (key.attempts > 0) view.title += ", " + to_string(key.attempts) + " PERCOBAAN";
+
+    for (const RankedScore& ranked : ranking.top(key, rows)) {
+        if (!store.recordValid(ranked.record)) continue;
+        view.entries.push_back(store.entryAt(ranked.record));
+        view.ranks.push_back(ranked.rank);
+    }
+
+    if (query.digits <= 0) return view;
+    RankingKey digitsKey{query.digits, 0};
+    string digits = to_string(query.digits) + " digit";
+    view.notes.push_back("Skor Anda: " + to_string(query.score));
+    view.notes.push_back(digits + ": " + describeRank(ranking.rank(digitsKey, query.score)));
+    view.notes.push_back(digits + ", " + to_string(query.attempts) + " percobaan: " +
+                         describeRank(ranking.rank({query.digits, query.attempts}, query.score)));
+    view.notes.push_back("Seluruh papan: " + describeRank(ranking.rank({}, query.score)));
+    PlayerBest best;
+    if (!query.player.empty() && ranking.playerBest(query.player, digitsKey, best)) {
+        view.notes.push_back("Skor terbaik " + query.player + " untuk " + digits + ": " + to_string(best.score));
+    }
+    return view;
+}
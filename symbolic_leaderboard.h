@@ -0,0 +1,125 @@
+/*
+ * SYMBOLIC NUMBLER - PENYIMPANAN PAPAN PERINGKAT BINER
+ *
+ * Semua skor disimpan selamanya di log biner hanya-tambah (append-only)
+ * dengan rekaman berukuran tetap dan checksum per rekaman. Log dibaca lewat
+ * mmap; urutan skor disimpan di file indeks terpisah yang ditulis ulang
+ * secara berkala (tulis ke file sementara lalu rename atomik). Beberapa
+ * proses game boleh menambah skor bersamaan; penulisan dijaga dengan flock.
+ *
+ *   symbolic_leaderboard.bin  header + ScoreRecord[]
+ *   symbolic_leaderboard.idx  header + nomor rekaman terurut menurut skor
+ */
+#ifndef SYMBOLIC_LEADERBOARD_H
+#define SYMBOLIC_LEADERBOARD_H
+
+#include "symbolic_mmap.h"
+#include "symbolic_ranking.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Struktur untuk menyimpan data di papan peringkat
+struct ScoreEntry {
+    std::string playerName;
+    int score;
+    int digits;
+    int attempts;
+    int64_t timestamp = 0;
+    uint32_t elapsedMs = 0; // Mode speedrun; 0 untuk permainan biasa
+};
+
+// Rekaman biner di log (little-endian, 48 byte)
+struct ScoreRecord {
+    char name[16];       // Diakhiri NUL, maksimal 15 karakter
+    int32_t score;
+    int32_t digits;
+    int32_t attempts;
+    uint32_t flags;
+    int64_t timestamp;   // Detik sejak epoch
+    uint32_t elapsedMs;  // Waktu speedrun, 0 jika tanpa waktu
+    uint32_t checksum;   // CRC-32 dari 44 byte sebelumnya
+};
+static_assert(sizeof(ScoreRecord) == 48, "ScoreRecord harus 48 byte");
+
+class LeaderboardStore {
+private:
+    std::string logPath;
+    std::string indexPath;
+    MappedFile log;
+    MappedFile index;
+
+    uint64_t generation = 0;      // Berubah setiap kali log ditulis ulang
+    size_t records = 0;           // Jumlah slot rekaman di log
+    size_t invalidRecords = 0;    // Slot dengan checksum salah
+    size_t coveredRecords = 0;    // Slot yang sudah tercakup indeks
+    const uint32_t* indexed = nullptr;
+    size_t indexedCount = 0;
+    std::vector<uint32_t> tail;   // Rekaman setelah indeks, terurut
+    ScoreRanking ranking;         // Dibangun saat pertama kali ditanya
+
+    bool ranksBefore(uint32_t a, uint32_t b) const;
+    bool mapLog();
+    void mapIndex();
+    void scanTail(size_t from);
+    bool append(const ScoreEntry* entries, size_t count);
+    bool writeIndex(const std::vector<uint32_t>& order);
+    bool rewriteLog();
+
+public:
+    static constexpr size_t COMPACT_THRESHOLD = 1024;
+
+    explicit LeaderboardStore(const std::string& path = "symbolic_leaderboard.bin");
+
+    // Memetakan log dan indeks; skor dari file teks lama diimpor sekali
+    bool load(const std::string& legacyTextPath = "symbolic_leaderboard.txt");
+
+    // Memetakan ulang log untuk melihat skor dari proses lain
+    bool refresh();
+
+    // Menambah satu skor (atau sekelompok skor) di bawah kunci file
+    bool add(const ScoreEntry& entry);
+    bool add(const std::vector<ScoreEntry>& entries);
+
+    // Menulis ulang indeks (dan log jika ada rekaman rusak) secara atomik
+    bool compact();
+
+    size_t size() const { return indexedCount + tail.size(); }
+    size_t recordCount() const { return records; }
+    size_t getInvalidRecords() const { return invalidRecords; }
+    size_t getTailSize() const { return tail.size(); }
+    const std::string& getPath() const { return logPath; }
+    uint64_t getGeneration() const { return generation; }
+
+    const ScoreRecord* recordAt(size_t recordNumber) const;
+    bool recordValid(size_t recordNumber) const;
+    ScoreEntry entryAt(size_t recordNumber) const;
+
+    // n skor tertinggi, tertinggi lebih dulu
+    std::vector<ScoreEntry> top(size_t n) const;
+
+    // Indeks peringkat per tingkat kesulitan, diperbarui dengan rekaman baru sejak panggilan terakhir
+    const ScoreRanking& rankings();
+};
+
+// Pemain yang baru mencetak skor; digits 0 berarti tanpa catatan posisi
+struct RankingQuery {
+    std::string player;
+    int score = 0;
+    int digits = 0;
+    int attempts = 0;
+};
+
+// Satu layar papan peringkat: skor teratas satu kelompok dan posisi pemain di bawahnya
+struct LeaderboardView {
+    std::string title;
+    std::vector<ScoreEntry> entries;
+    std::vector<size_t> ranks;      // Skor sama berbagi nomor peringkat
+    std::vector<std::string> notes;
+};
+
+LeaderboardView leaderboardView(LeaderboardStore& store, RankingKey key, size_t rows, const RankingQuery& query = {});
+
+#endif
@@ -0,0 +1,312 @@
+/*
+ * SYMBOLIC NUMBLER - PEMBANGKIT BEBAN UNTUK SERVER
+ *
+ * Membuka banyak koneksi sekaligus, memainkan satu permainan per koneksi
+ * dengan mengetik satu tombol, menunggu frame jawabannya (akhir frame
+ * ditandai "\033[J"), lalu mengetik tombol berikutnya. Melaporkan sesi per
+ * detik dan latensi tombol-ke-frame (p50/p99/maks).
+ *
+ * Contoh:
+ *   symbolic_loadgen --port 4000 --connections 1000 --sessions 20000
+ *   symbolic_loadgen --unix /tmp/symbolic.sock --level 2
+ */
+#include "symbolic_random.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace {
+
+using Clock = chrono::steady_clock;
+
+constexpr char FRAME_END[] = "\033[J";
+constexpr size_t FRAME_END_LENGTH = sizeof FRAME_END - 1;
+constexpr int IDLE_TIMEOUT_MS = 5000;
+
+struct LoadOptions {
+    string host = "127.0.0.1";
+    int port = 4000;
+    string unixPath;
+    unsigned connections = 100;
+    uint64_t sessions = 1000;
+    unsigned threads = 0;
+    char level = '1';
+    uint64_t seed = 1;
+};
+
+struct LoadStats {
+    uint64_t sessions = 0;
+    uint64_t failures = 0;
+    uint64_t frames = 0;
+    uint64_t bytes = 0;
+    vector<uint64_t> latencies; // Nanodetik per tombol
+};
+
+// Satu koneksi yang sedang memainkan skrip tombolnya
+struct Client {
+    int fd = -1;
+    string script;
+    size_t next = 0;
+    size_t matched = 0;    // Panjang awalan FRAME_END yang sudah cocok
+    bool awaiting = false; // Tombol terkirim, frame jawabannya belum tiba
+    bool ready = false;    // Frame sudah tiba, tombol berikutnya boleh dikirim
+    bool gotFrame = false;
+    Clock::time_point sentAt;
+};
+
+// Tombol menu, lewati instruksi, semua percobaan dengan tebakan acak, lalu "tidak main lagi"
+string makeScript(char level, Rng& gen) {
+    int digits = 4, attempts = 6;
+    switch (level) {
+        case '1': digits = 3; attempts = 6; break;
+        case '2': digits = 4; attempts = 6; break;
+        case '3': digits = 5; attempts = 6; break;
+        case '4': digits = 6; attempts = 8; break;
+    }
+    string script;
+    script += level;
+    script += ' ';
+    for (int a = 0; a < attempts; a++) {
+        for (int d = 0; d < digits; d++) script += static_cast<char>('0' + gen.below(10));
+        script += '\r';
+    }
+    script += 'n';
+    return script;
+}
+
+int connectClient(const LoadOptions& options) {
+    int family = options.unixPath.empty() ? AF_INET : AF_UNIX;
+    int fd = socket(family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+
+    int result;
+    if (family == AF_UNIX) {
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        strncpy(address.sun_path, options.unixPath.c_str(), sizeof address.sun_path - 1);
+        result = connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof address);
+    } else {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof one);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(options.port));
+        inet_pton(AF_INET, options.host.c_str(), &address.sin_addr);
+        result = connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof address);
+    }
+    if (result < 0 && errno != EINPROGRESS && errno != EAGAIN) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void loadWorker(const LoadOptions& options, unsigned concurrent, uint64_t quota, Rng gen, LoadStats& stats) {
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    vector<Client> clients(concurrent);
+    uint64_t started = 0, finished = 0;
+
+    auto open = [&](uint32_t index) {
+        Client& client = clients[index];
+        client = Client();
+        if (started >= quota) return;
+        started++;
+        client.fd = connectClient(options);
+        epoll_event event = {};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.u32 = index;
+        if (client.fd < 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, client.fd, &event) < 0) {
+            if (client.fd >= 0) close(client.fd);
+            client.fd = -1;
+            stats.failures++;
+            finished++;
+            return;
+        }
+        client.script = makeScript(options.level, gen);
+    };
+
+    // Sesi selesai jika server menutup setelah frame pertama atau skrip habis
+    auto finish = [&](uint32_t index, bool ok) {
+        Client& client = clients[index];
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, client.fd, nullptr);
+        close(client.fd);
+        if (ok) stats.sessions++;
+        else stats.failures++;
+        finished++;
+        open(index);
+    };
+
+    for (uint32_t i = 0; i < concurrent; i++) open(i);
+
+    vector<epoll_event> events(max(1u, concurrent));
+    char buffer[16384];
+    while (finished < quota) {
+        int count = epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), IDLE_TIMEOUT_MS);
+        if (count < 0 && errno == EINTR) continue;
+        if (count <= 0) {
+            // Server berhenti menjawab: semua sesi yang tersisa dihitung gagal
+            for (auto& client : clients) {
+                if (client.fd >= 0) close(client.fd);
+            }
+            stats.failures += quota - finished;
+            break;
+        }
+
+        for (int e = 0; e < count; e++) {
+            uint32_t index = events[e].data.u32;
+            Client& client = clients[index];
+            bool closed = false;
+            while (true) {
+                ssize_t n = read(client.fd, buffer, sizeof buffer);
+                if (n < 0 && errno == EINTR) continue;
+                if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+                if (n <= 0) {
+                    closed = true;
+                    break;
+                }
+                stats.bytes += static_cast<uint64_t>(n);
+                for (ssize_t i = 0; i < n; i++) {
+                    if (buffer[i] == FRAME_END[client.matched]) client.matched++;
+                    else client.matched = (buffer[i] == FRAME_END[0]) ? 1 : 0;
+                    if (client.matched < FRAME_END_LENGTH) continue;
+
+                    client.matched = 0;
+                    stats.frames++;
+                    client.gotFrame = true;
+                    client.ready = true;
+                    if (client.awaiting) {
+                        stats.latencies.push_back(
+                            chrono::duration_cast<chrono::nanoseconds>(Clock::now() - client.sentAt).count());
+                        client.awaiting = false;
+                    }
+                }
+            }
+            if (closed) {
+                finish(index, client.gotFrame);
+                continue;
+            }
+            if (!client.ready || client.awaiting) continue;
+            if (client.next == client.script.size()) {
+                finish(index, true);
+                continue;
+            }
+
+            client.ready = false;
+            client.awaiting = true;
+            client.sentAt = Clock::now();
+            if (send(client.fd, &client.script[client.next++], 1, MSG_NOSIGNAL) != 1) finish(index, false);
+        }
+    }
+    close(epollFd);
+}
+
+double percentileMs(vector<uint64_t>& values, double fraction) {
+    if (values.empty()) return 0.0;
+    size_t k = min(values.size() - 1, static_cast<size_t>(fraction * values.size()));
+    nth_element(values.begin(), values.begin() + k, values.end());
+    return values[k] / 1e6;
+}
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " [opsi]\n"
+         << "  --host A          Alamat server (bawaan: 127.0.0.1)\n"
+         << "  --port N          Port TCP (bawaan: 4000)\n"
+         << "  --unix PATH       Memakai soket Unix, bukan TCP\n"
+         << "  --connections N   Koneksi bersamaan (bawaan: 100)\n"
+         << "  --sessions N      Jumlah sesi total (bawaan: 1000)\n"
+         << "  --threads N       Jumlah thread klien (bawaan: min(4, inti))\n"
+         << "  --level L         Tombol menu tingkat kesulitan 1-4 (bawaan: 1)\n"
+         << "  --seed N          Benih tebakan acak (bawaan: 1)\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    LoadOptions options;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--host") == 0 && hasValue) options.host = argv[++i];
+        else if (strcmp(arg, "--port") == 0 && hasValue) options.port = atoi(argv[++i]);
+        else if (strcmp(arg, "--unix") == 0 && hasValue) options.unixPath = argv[++i];
+        else if (strcmp(arg, "--connections") == 0 && hasValue) options.connections = static_cast<unsigned>(atoi(argv[++i]));
+        else if (strcmp(arg, "--sessions") == 0 && hasValue) options.sessions = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--threads") == 0 && hasValue) options.threads = static_cast<unsigned>(atoi(argv[++i]));
+        else if (strcmp(arg, "--level") == 0 && hasValue) options.level = argv[++i][0];
+        else if (strcmp(arg, "--seed") == 0 && hasValue) options.seed = strtoull(argv[++i], nullptr, 10);
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (options.level < '1' || options.level > '4' || options.connections == 0 || options.sessions == 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    unsigned threads = options.threads ? options.threads : min(4u, max(1u, thread::hardware_concurrency()));
+    threads = min(threads, options.connections);
+    vector<LoadStats> locals(threads);
+    vector<thread> workers;
+
+    // Satu aliran per thread dari --seed (hanya bagian inline Rng; loadgen tidak memakai pustaka)
+    Rng master(options.seed);
+    auto start = Clock::now();
+    for (unsigned t = 0; t < threads; t++) {
+        unsigned concurrent = options.connections / threads + (t < options.connections % threads ? 1 : 0);
+        uint64_t quota = options.sessions / threads + (t < options.sessions % threads ? 1 : 0);
+        workers.emplace_back(loadWorker, cref(options), concurrent, quota, master.split(), ref(locals[t]));
+    }
+    for (auto& worker : workers) worker.join();
+    double seconds = chrono::duration<double>(Clock::now() - start).count();
+
+    LoadStats total;
+    for (auto& local : locals) {
+        total.sessions += local.sessions;
+        total.failures += local.failures;
+        total.frames += local.frames;
+        total.bytes += local.bytes;
+        total.latencies.insert(total.latencies.end(), local.latencies.begin(), local.latencies.end());
+    }
+
+    cout << fixed << setprecision(2);
+    cout << "Sesi             : " << total.sessions << " berhasil, " << total.failures << " gagal dalam "
+         << seconds << " detik\n"
+         << "Sesi/detik       : " << total.sessions / seconds << "\n"
+         << "Tombol/detik     : " << total.latencies.size() / seconds << "\n"
+         << "Frame            : " << total.frames << ", rata-rata "
+         << (total.frames ? total.bytes / total.frames : 0) << " byte/frame\n";
+    cout << setprecision(3);
+    double p50 = percentileMs(total.latencies, 0.50);
+    double p99 = percentileMs(total.latencies, 0.99);
+    double worst = total.latencies.empty() ? 0.0 : *max_element(total.latencies.begin(), total.latencies.end()) / 1e6;
+    cout << "Latensi tombol   : p50 " << p50 << " ms, p99 " << p99 << " ms, maks " << worst << " ms\n";
+    return total.failures ? 1 : 0;
+}
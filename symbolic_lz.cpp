@@ -0,0 +1,118 @@
+#include "symbolic_lz.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+constexpr int HASH_BITS = 14;
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t MAX_OFFSET = 65535;
+constexpr uint32_t NO_POSITION = UINT32_MAX;
+
+uint32_t read32(const uint8_t* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof value);
+    return value;
+}
+
+uint32_t hashOf(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+// Panjang >= 15 disimpan sebagai 15 di token lalu sisanya dalam byte 255
+void writeLength(vector<uint8_t>& out, size_t extra) {
+    while (extra >= 255) {
+        out.push_back(255);
+        extra -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(extra));
+}
+
+void emit(vector<uint8_t>& out, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength) {
+    size_t matchCode = matchLength ? matchLength - MIN_MATCH : 0;
+    uint8_t token = static_cast<uint8_t>((literalLength < 15 ? literalLength : 15) << 4 | (matchCode < 15 ? matchCode : 15));
+    out.push_back(token);
+    if (literalLength >= 15) writeLength(out, literalLength - 15);
+    out.insert(out.end(), literals, literals + literalLength);
+    if (matchLength == 0) return; // Urutan terakhir: hanya literal
+    out.push_back(static_cast<uint8_t>(offset & 0xFF));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchCode >= 15) writeLength(out, matchCode - 15);
+}
+
+bool readLength(const uint8_t*& in, const uint8_t* end, size_t& length) {
+    uint8_t byte;
+    do {
+        if (in >= end) return false;
+        byte = *in++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+} // namespace
+
+size_t lzCompressBound(size_t size) {
+    return size + size / 255 + 16;
+}
+
+void lzCompress(const uint8_t* input, size_t size, vector<uint8_t>& out) {
+    out.clear();
+    out.reserve(lzCompressBound(size));
+    vector<uint32_t> table(size_t{1} << HASH_BITS, NO_POSITION);
+
+    size_t anchor = 0, i = 0;
+    while (i + MIN_MATCH <= size) {
+        uint32_t sequence = read32(input + i);
+        uint32_t& slot = table[hashOf(sequence)];
+        uint32_t candidate = slot;
+        slot = static_cast<uint32_t>(i);
+        if (candidate == NO_POSITION || i - candidate > MAX_OFFSET || read32(input + candidate) != sequence) {
+            i++;
+            continue;
+        }
+        size_t length = MIN_MATCH;
+        while (i + length < size && input[candidate + length] == input[i + length]) length++;
+        emit(out, input + anchor, i - anchor, i - candidate, length);
+        i += length;
+        anchor = i;
+    }
+    emit(out, input + anchor, size - anchor, 0, 0);
+}
+
+bool lzDecompress(const uint8_t* input, size_t size, uint8_t* output, size_t outputSize) {
+    const uint8_t* in = input;
+    const uint8_t* end = input + size;
+    size_t produced = 0;
+    while (in < end) {
+        uint8_t token = *in++;
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(in, end, literalLength)) return false;
+        if (literalLength > static_cast<size_t>(end - in) || literalLength > outputSize - produced) return false;
+        memcpy(output + produced, in, literalLength);
+        in += literalLength;
+        produced += literalLength;
+        if (in == end) break;
+
+        if (end - in < 2) return false;
+        size_t offset = in[0] | (static_cast<size_t>(in[1]) << 8);
+        in += 2;
+        size_t matchLength = (token & 0x0F);
+        if (matchLength == 15 && !readLength(in, end, matchLength)) return false;
+        matchLength += MIN_MATCH;
+        if (offset == 0 || offset > produced || matchLength > outputSize - produced) return false;
+
+        // Salinan boleh tumpang-tindih (offset < panjang mengulang pola)
+        const uint8_t* from = output + produced - offset;
+        uint8_t* to = output + produced;
+        if (offset >= matchLength) {
+            memcpy(to, from, matchLength);
+        } else {
+            for (size_t k = 0; k < matchLength; k++) to[k] = from[k];
+        }
+        produced += matchLength;
+    }
+    return produced == outputSize;
+}
@@ -0,0 +1,25 @@
+/*
+ * SYMBOLIC NUMBLER - KOMPRESI BLOK LZ77 SEDERHANA
+ *
+ * Format urutan bergaya LZ4: token (4 bit panjang literal, 4 bit panjang
+ * cocokan - 4), literal, offset 16 bit little-endian, lalu perpanjangan
+ * panjang dengan byte 255. Kompresi memakai satu tabel hash 4 byte tanpa
+ * rantai; dekompresi hanya menyalin byte, jauh di atas kecepatan disk.
+ */
+#ifndef SYMBOLIC_LZ_H
+#define SYMBOLIC_LZ_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Ukuran keluaran terburuk untuk masukan size byte (semua literal)
+size_t lzCompressBound(size_t size);
+
+// Mengganti isi out dengan hasil kompresi
+void lzCompress(const uint8_t* input, size_t size, std::vector<uint8_t>& out);
+
+// true jika masukan sah dan menghasilkan tepat outputSize byte
+bool lzDecompress(const uint8_t* input, size_t size, uint8_t* output, size_t outputSize);
+
+#endif
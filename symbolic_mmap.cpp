@@ -0,0 +1,57 @@
+#include "symbolic_mmap.h"
+
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+bool MappedFile::open(const string& path) {
+    close();
+#ifdef _WIN32
+    ifstream file(path, ios::binary);
+    if (!file.is_open()) return false;
+    fallback.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+    bytes = fallback.data();
+    length = fallback.size();
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) < 0) {
+        ::close(fd);
+        return false;
+    }
+    length = static_cast<size_t>(info.st_size);
+    if (length > 0) {
+        void* address = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+            ::close(fd);
+            length = 0;
+            return false;
+        }
+        bytes = static_cast<const unsigned char*>(address);
+        mapped = true;
+    }
+    // Pemetaan tetap berlaku setelah descriptor ditutup
+    ::close(fd);
+#endif
+    opened = true;
+    return true;
+}
+
+void MappedFile::close() {
+#ifndef _WIN32
+    if (mapped) munmap(const_cast<unsigned char*>(bytes), length);
+#endif
+    bytes = nullptr;
+    length = 0;
+    mapped = false;
+    opened = false;
+    fallback.clear();
+}
@@ -0,0 +1,36 @@
+/*
+ * SYMBOLIC NUMBLER - FILE TERPETAKAN KE MEMORI (HANYA BACA)
+ *
+ * POSIX memakai mmap; di Windows isi file dibaca ke memori sebagai cadangan.
+ */
+#ifndef SYMBOLIC_MMAP_H
+#define SYMBOLIC_MMAP_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class MappedFile {
+private:
+    const unsigned char* bytes = nullptr;
+    size_t length = 0;
+    bool mapped = false; // true jika bytes berasal dari mmap
+    bool opened = false;
+    std::vector<unsigned char> fallback;
+
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Memetakan seluruh file; false jika file tidak ada atau gagal dibaca
+    bool open(const std::string& path);
+    void close();
+
+    const unsigned char* data() const { return bytes; }
+    size_t size() const { return length; }
+    bool isOpen() const { return opened; }
+};
+
+#endif
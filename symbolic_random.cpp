@@ -0,0 +1,154 @@
+#include "symbolic_random.h"
+#include "symbolic_feedback.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <random>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+constexpr uint64_t POWERS_OF_TEN[20] = {1ULL,
+                                        10ULL,
+                                        100ULL,
+                                        1000ULL,
+                                        10000ULL,
+                                        100000ULL,
+                                        1000000ULL,
+                                        10000000ULL,
+                                        100000000ULL,
+                                        1000000000ULL,
+                                        10000000000ULL,
+                                        100000000000ULL,
+                                        1000000000000ULL,
+                                        10000000000000ULL,
+                                        100000000000000ULL,
+                                        1000000000000000ULL,
+                                        10000000000000000ULL,
+                                        100000000000000000ULL,
+                                        1000000000000000000ULL,
+                                        10000000000000000000ULL};
+
+// Garam tetap agar benih harian tidak sama dengan benih kecil yang diketik pengguna
+constexpr uint64_t DAILY_SALT = 0x53594D424F4C4943ULL; // "SYMBOLIC"
+constexpr int64_t SECONDS_PER_DAY = 86400;
+
+// Menjalankan work(chunk, rng) untuk setiap potongan; aliran potongan ke-k selalu hasil split() ke-k
+template <typename Work>
+void forEachChunk(uint64_t seed, size_t count, unsigned threads, Work work) {
+    size_t chunks = (count + TARGET_CHUNK - 1) / TARGET_CHUNK;
+    vector<Rng> streams;
+    streams.reserve(chunks);
+    Rng master(seed);
+    for (size_t k = 0; k < chunks; k++) streams.push_back(master.split());
+
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+    threads = static_cast<unsigned>(min<size_t>(threads, max<size_t>(chunks, 1)));
+    if (threads <= 1) {
+        for (size_t k = 0; k < chunks; k++) work(k, streams[k]);
+        return;
+    }
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            for (size_t k = t; k < chunks; k += threads) work(k, streams[k]);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+}
+
+// Tanggal sipil dari jumlah hari sejak 1970-01-01 (algoritma Howard Hinnant), tanpa gmtime
+void civilFromDays(int64_t days, int& year, unsigned& month, unsigned& day) {
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+    const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const unsigned shiftedMonth = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+    month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+    year = static_cast<int>(yearOfEra + era * 400 + (month <= 2));
+}
+
+} // namespace
+
+Rng Rng::fromDevice() {
+    random_device device;
+    uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+    return Rng(seed);
+}
+
+Rng Rng::fromEnvironment() {
+    const char* seed = getenv("SYMBOLIC_SEED");
+    if (seed && *seed) return Rng(strtoull(seed, nullptr, 10));
+    return fromDevice();
+}
+
+uint64_t powerOfTen(int digits) {
+    return POWERS_OF_TEN[digits];
+}
+
+string generateTarget(int numDigits, Rng& rng) {
+    string target(static_cast<size_t>(numDigits), '0');
+    // Satu nilai acak < 10^19 per potongan 19 digit, ditulis dari kanan
+    for (int end = numDigits; end > 0; end -= 19) {
+        int width = min(end, 19);
+        uint64_t value = rng.below(POWERS_OF_TEN[width]);
+        for (int i = end - 1; i >= end - width; i--) {
+            target[static_cast<size_t>(i)] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+    }
+    return target;
+}
+
+void generateTargetValues(uint64_t seed, int digits, uint64_t* out, size_t count, unsigned threads) {
+    const uint64_t bound = POWERS_OF_TEN[digits];
+    forEachChunk(seed, count, threads, [&](size_t chunk, Rng& rng) {
+        size_t begin = chunk * TARGET_CHUNK;
+        size_t end = min(count, begin + TARGET_CHUNK);
+        for (size_t i = begin; i < end; i++) out[i] = rng.below(bound);
+    });
+}
+
+void generateTargets(uint64_t seed, int digits, size_t count, PackedCandidates& out, unsigned threads) {
+    out = PackedCandidates(digits);
+    out.resize(count);
+    const uint64_t bound = POWERS_OF_TEN[digits];
+    forEachChunk(seed, count, threads, [&](size_t chunk, Rng& rng) {
+        size_t begin = chunk * TARGET_CHUNK;
+        size_t end = min(count, begin + TARGET_CHUNK);
+        uint64_t values[1024];
+        for (size_t i = begin; i < end; i += 1024) {
+            size_t n = min<size_t>(1024, end - i);
+            for (size_t k = 0; k < n; k++) values[k] = rng.below(bound);
+            out.assign(i, values, n);
+        }
+    });
+}
+
+DailyChallenge dailyChallenge(int64_t unixSeconds) {
+    // Pembagian ke bawah agar detik sebelum 1970 tetap jatuh di hari yang benar
+    int64_t days = unixSeconds / SECONDS_PER_DAY - (unixSeconds % SECONDS_PER_DAY < 0 ? 1 : 0);
+    int year;
+    unsigned month, day;
+    civilFromDays(days, year, month, day);
+
+    char date[32];
+    snprintf(date, sizeof date, "%04d-%02u-%02u", year, month, day);
+    uint64_t mix = DAILY_SALT ^ static_cast<uint64_t>(days);
+    return DailyChallenge{date, Rng::splitmix64(mix), DAILY_DIGITS, DAILY_ATTEMPTS};
+}
+
+DailyChallenge todaysChallenge() {
+    return dailyChallenge(static_cast<int64_t>(time(nullptr)));
+}
+
+string challengeTarget(const DailyChallenge& challenge) {
+    Rng rng(challenge.seed);
+    return generateTarget(challenge.digits, rng);
+}
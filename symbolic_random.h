@@ -0,0 +1,168 @@
+/*
+ * SYMBOLIC NUMBLER - GENERATOR ACAK BERBENIH
+ *
+ * xoshiro256** (32 byte status) dengan benih splitmix64. Semua turunan
+ * (angka dalam rentang, digit target) memakai aritmetika bilangan bulat
+ * sendiri, bukan distribusi std:: yang hasilnya berbeda antar pustaka
+ * standar, sehingga benih yang sama menghasilkan target yang sama di
+ * semua platform dan kompiler.
+ *
+ * split() memberi aliran baru yang tidak tumpang-tindih (lompatan 2^128
+ * langkah), jadi setiap thread atau reactor mendapat aliran deterministik
+ * dari satu benih induk.
+ */
+#ifndef SYMBOLIC_RANDOM_H
+#define SYMBOLIC_RANDOM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class PackedCandidates;
+
+class Rng {
+private:
+    uint64_t state[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    // Bagian atas hasil kali 64x64 bit
+    static uint64_t mulHigh(uint64_t a, uint64_t b, uint64_t& low) {
+#ifdef __SIZEOF_INT128__
+        unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        low = static_cast<uint64_t>(product);
+        return static_cast<uint64_t>(product >> 64);
+#else
+        uint64_t aLow = a & 0xFFFFFFFFu, aHigh = a >> 32, bLow = b & 0xFFFFFFFFu, bHigh = b >> 32;
+        uint64_t ll = aLow * bLow, lh = aLow * bHigh, hl = aHigh * bLow, hh = aHigh * bHigh;
+        uint64_t middle = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+        low = (middle << 32) | (ll & 0xFFFFFFFFu);
+        return hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+#endif
+    }
+
+public:
+    using result_type = uint64_t;
+
+    static uint64_t splitmix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    explicit Rng(uint64_t seed = 0) {
+        for (uint64_t& word : state) word = splitmix64(seed);
+    }
+
+    // Benih dari random_device untuk permainan biasa
+    static Rng fromDevice();
+
+    // SYMBOLIC_SEED=N memakai benih tetap (permainan bisa diulang), selain itu fromDevice()
+    static Rng fromEnvironment();
+
+    // Memenuhi UniformRandomBitGenerator
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    result_type operator()() {
+        const uint64_t result = rotl(state[1] * 5, 7) * 9;
+        const uint64_t shifted = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    // Seragam di [0, bound), bound > 0; metode kali-geser Lemire tanpa bias
+    uint64_t below(uint64_t bound) {
+        uint64_t low;
+        uint64_t high = mulHigh((*this)(), bound, low);
+        if (low < bound) {
+            uint64_t threshold = (0 - bound) % bound;
+            while (low < threshold) high = mulHigh((*this)(), bound, low);
+        }
+        return high;
+    }
+
+    // Maju 2^128 langkah
+    void jump() {
+        static constexpr uint64_t JUMP[4] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL,
+                                             0x39ABDC4529B1661CULL};
+        uint64_t next[4] = {};
+        for (uint64_t word : JUMP) {
+            for (int bit = 0; bit < 64; bit++) {
+                if (word & (uint64_t{1} << bit)) {
+                    for (int k = 0; k < 4; k++) next[k] ^= state[k];
+                }
+                (*this)();
+            }
+        }
+        for (int k = 0; k < 4; k++) state[k] = next[k];
+    }
+
+    // Mengembalikan aliran saat ini lalu melompat, sehingga panggilan berikutnya memberi aliran lain
+    Rng split() {
+        Rng stream = *this;
+        jump();
+        return stream;
+    }
+
+    // Aliran ke-index dari benih: sama dengan hasil split() ke-(index + 1) dari Rng(seed)
+    static Rng stream(uint64_t seed, uint64_t index) {
+        Rng rng(seed);
+        for (uint64_t i = 0; i < index; i++) rng.jump();
+        return rng;
+    }
+
+    bool operator==(const Rng& other) const {
+        return state[0] == other.state[0] && state[1] == other.state[1] && state[2] == other.state[2] &&
+               state[3] == other.state[3];
+    }
+};
+
+// 10^digits untuk 0-19 digit
+uint64_t powerOfTen(int digits);
+
+// Target acak numDigits digit; 19 digit per panggilan generator
+std::string generateTarget(int numDigits, Rng& rng);
+
+/*
+ * PEMBUATAN MASSAL
+ * Keluaran dibagi ke potongan TARGET_CHUNK target dengan aliran sendiri per
+ * potongan, jadi hasil untuk benih yang sama tidak bergantung jumlah thread.
+ */
+constexpr size_t TARGET_CHUNK = 1 << 16;
+
+// out[i] < 10^digits (digits 1-19)
+void generateTargetValues(uint64_t seed, int digits, uint64_t* out, size_t count, unsigned threads = 0);
+
+// Langsung ke bentuk kandidat terkemas untuk kernel massal dan simulasi (digits 1-10)
+void generateTargets(uint64_t seed, int digits, size_t count, PackedCandidates& out, unsigned threads = 0);
+
+/*
+ * TANTANGAN HARIAN
+ * Benih diturunkan dari tanggal UTC saja, jadi semua pemain (TUI, server,
+ * mesin mana pun) mendapat target yang sama sepanjang hari itu.
+ */
+struct DailyChallenge {
+    std::string date; // YYYY-MM-DD (UTC)
+    uint64_t seed;
+    int digits;
+    int maxAttempts;
+};
+
+constexpr int DAILY_DIGITS = 5;
+constexpr int DAILY_ATTEMPTS = 7;
+
+DailyChallenge dailyChallenge(int64_t unixSeconds);
+DailyChallenge todaysChallenge();
+
+// Target tantangan: generateTarget dengan Rng(challenge.seed)
+std::string challengeTarget(const DailyChallenge& challenge);
+
+#endif
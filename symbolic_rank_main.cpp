@@ -0,0 +1,239 @@
+/*
+ * SYMBOLIC NUMBLER - KUERI PAPAN PERINGKAT
+ *
+ * Contoh:
+ *   symbolic_rank top --digits 4 --count 20
+ *   symbolic_rank rank 450 --digits 4 --attempts 3
+ *   symbolic_rank player budi
+ *   symbolic_rank summary
+ *   symbolic_rank generate --scores 1000000
+ */
+#include "symbolic_core.h"
+#include "symbolic_leaderboard.h"
+#include "symbolic_random.h"
+#include "symbolic_ranking.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+struct Options {
+    string command;
+    string argument;    // Skor untuk rank, nama untuk player
+    string file = "symbolic_leaderboard.bin";
+    RankingKey key;
+    size_t count = 10;
+    size_t from = 0;
+    uint64_t scores = 100000;
+    uint64_t seed = 1;
+};
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " <perintah> [opsi]\n"
+         << "Perintah:\n"
+         << "  top             Skor teratas (--count N, --from N untuk mulai dari peringkat N+1)\n"
+         << "  rank SKOR       Peringkat dan persentil sebuah skor\n"
+         << "  player NAMA     Skor terbaik pemain per tingkat kesulitan beserta peringkatnya\n"
+         << "  summary         Jumlah skor dan skor tertinggi per (digit, percobaan)\n"
+         << "  generate        Menambah skor acak untuk uji coba (--scores N, --seed N)\n"
+         << "Opsi umum:\n"
+         << "  --digits N      Hanya skor N digit (bawaan: semua)\n"
+         << "  --attempts N    Hanya kemenangan dalam N percobaan (bawaan: semua)\n"
+         << "  --file F        File papan peringkat (bawaan: symbolic_leaderboard.bin)\n";
+}
+
+string describeKey(RankingKey key) {
+    if (key.digits <= 0) return "seluruh papan";
+    string text = to_string(key.digits) + " digit";
+    if (key.attempts > 0) text += ", " + to_string(key.attempts) + " percobaan";
+    return text;
+}
+
+void printRank(const RankInfo& info) {
+    cout << "#" << info.rank << " dari " << info.total << " (persentil " << fixed << setprecision(1) << info.percentile
+         << ")";
+}
+
+/*
+ * TOP
+ */
+int runTop(LeaderboardStore& store, const Options& options) {
+    const ScoreRanking& ranking = store.rankings();
+    vector<RankedScore> ranked = ranking.top(options.key, options.count, options.from);
+    cout << "Papan peringkat, " << describeKey(options.key) << ":\n";
+    cout << setw(8) << "No." << "  " << setw(16) << "Nama" << "  " << setw(7) << "Skor" << "  " << setw(6) << "Digit"
+         << "  " << setw(9) << "Percobaan" << "  " << setw(9) << "Speedrun" << "\n";
+    for (const RankedScore& entry : ranked) {
+        if (!store.recordValid(entry.record)) continue;
+        ScoreEntry score = store.entryAt(entry.record);
+        cout << setw(8) << entry.rank << "  " << setw(16) << score.playerName << "  " << setw(7) << score.score << "  "
+             << setw(6) << score.digits << "  " << setw(9) << score.attempts << "  ";
+        if (score.elapsedMs) cout << setw(8) << fixed << setprecision(1) << score.elapsedMs / 1000.0 << "s\n";
+        else cout << setw(9) << "-" << "\n";
+    }
+    if (ranked.empty()) cout << "(kosong)\n";
+    return 0;
+}
+
+/*
+ * RANK
+ */
+int runRank(LeaderboardStore& store, const Options& options) {
+    char* end = nullptr;
+    long score = strtol(options.argument.c_str(), &end, 10);
+    if (options.argument.empty() || *end != '\0') {
+        cerr << "Skor harus berupa angka.\n";
+        return 1;
+    }
+    RankInfo info = store.rankings().rank(options.key, static_cast<int>(score));
+    if (!info.found()) {
+        cout << "Belum ada skor untuk " << describeKey(options.key) << ".\n";
+        return 0;
+    }
+    cout << "Skor " << score << ", " << describeKey(options.key) << ": ";
+    printRank(info);
+    if (info.tied > 0) cout << ", " << info.tied << " skor sama";
+    cout << "\n";
+    return 0;
+}
+
+/*
+ * PLAYER
+ */
+int runPlayer(LeaderboardStore& store, const Options& options) {
+    const ScoreRanking& ranking = store.rankings();
+    vector<PlayerBest> bests = ranking.playerBests(options.argument);
+    if (bests.empty()) {
+        cout << "Pemain " << options.argument << " belum punya skor.\n";
+        return 0;
+    }
+    PlayerBest overall;
+    if (ranking.playerBest(options.argument, {}, overall)) {
+        cout << options.argument << ": skor terbaik " << overall.score << ", seluruh papan ";
+        printRank(ranking.rank({}, overall.score));
+        cout << "\n\n";
+    }
+    cout << setw(6) << "Digit" << "  " << setw(9) << "Percobaan" << "  " << setw(7) << "Skor" << "  Peringkat\n";
+    for (const PlayerBest& best : bests) {
+        cout << setw(6) << best.key.digits << "  " << setw(9) << best.key.attempts << "  " << setw(7) << best.score << "  ";
+        printRank(ranking.rank(best.key, best.score));
+        cout << "\n";
+    }
+    return 0;
+}
+
+/*
+ * SUMMARY
+ */
+int runSummary(LeaderboardStore& store) {
+    auto start = chrono::steady_clock::now();
+    const ScoreRanking& ranking = store.rankings();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << store.size() << " skor di " << store.getPath() << ", indeks peringkat dibangun dalam " << fixed
+         << setprecision(1) << seconds * 1000.0 << " ms\n\n";
+
+    cout << setw(6) << "Digit" << "  " << setw(9) << "Percobaan" << "  " << setw(10) << "Skor" << "  " << setw(8)
+         << "Terbaik" << "  Pemegang\n";
+    for (const DifficultySummary& summary : ranking.difficulties()) {
+        cout << setw(6) << summary.key.digits << "  " << setw(9) << summary.key.attempts << "  " << setw(10)
+             << summary.total << "  " << setw(8) << summary.bestScore << "  "
+             << (store.recordValid(summary.bestRecord) ? store.entryAt(summary.bestRecord).playerName : "?") << "\n";
+    }
+    return 0;
+}
+
+/*
+ * GENERATE: kemenangan acak dengan skor yang sama seperti permainan sungguhan
+ */
+int runGenerate(LeaderboardStore& store, const Options& options) {
+    constexpr uint64_t BATCH = 65536;
+    static const int DIGITS[] = {3, 4, 5, 6};
+    static const int MAX_ATTEMPTS[] = {6, 6, 6, 8};
+    Rng gen(options.seed);
+    auto start = chrono::steady_clock::now();
+
+    vector<ScoreEntry> batch;
+    for (uint64_t done = 0; done < options.scores; done += batch.size()) {
+        batch.assign(static_cast<size_t>(min(BATCH, options.scores - done)), ScoreEntry{});
+        for (ScoreEntry& entry : batch) {
+            size_t level = static_cast<size_t>(gen.below(4));
+            entry.playerName = "pemain" + to_string(1 + gen.below(10000));
+            entry.digits = DIGITS[level];
+            entry.attempts = 1 + static_cast<int>(gen.below(static_cast<uint64_t>(MAX_ATTEMPTS[level])));
+            if (gen.below(5) == 0) {
+                entry.elapsedMs = static_cast<uint32_t>(5000 + gen.below(120000));
+                entry.score = calculateTimedScore(MAX_ATTEMPTS[level], entry.attempts, entry.digits, entry.elapsedMs);
+            } else {
+                entry.score = calculateScore(MAX_ATTEMPTS[level], entry.attempts, entry.digits);
+            }
+        }
+        if (!store.add(batch)) {
+            cerr << "Gagal menulis ke " << store.getPath() << "\n";
+            return 1;
+        }
+    }
+    store.compact();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << options.scores << " skor ditambahkan ke " << store.getPath() << " dalam " << fixed << setprecision(2)
+         << seconds << " detik (" << store.size() << " total)\n";
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    options.command = argv[1];
+    int first = 2;
+    if (options.command == "rank" || options.command == "player") {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        options.argument = argv[2];
+        first = 3;
+    }
+
+    for (int i = first; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--file") == 0 && hasValue) options.file = argv[++i];
+        else if (strcmp(arg, "--digits") == 0 && hasValue) options.key.digits = atoi(argv[++i]);
+        else if (strcmp(arg, "--attempts") == 0 && hasValue) options.key.attempts = atoi(argv[++i]);
+        else if (strcmp(arg, "--count") == 0 && hasValue) options.count = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--from") == 0 && hasValue) options.from = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--scores") == 0 && hasValue) options.scores = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--seed") == 0 && hasValue) options.seed = strtoull(argv[++i], nullptr, 10);
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    // Percobaan tanpa digit tidak punya kelompok sendiri
+    if (options.key.digits <= 0) options.key.attempts = 0;
+
+    LeaderboardStore store(options.file);
+    if (!store.load("")) {
+        cerr << "Tidak bisa membuka papan peringkat " << options.file << "\n";
+        return 1;
+    }
+    if (options.command == "top") return runTop(store, options);
+    if (options.command == "rank") return runRank(store, options);
+    if (options.command == "player") return runPlayer(store, options);
+    if (options.command == "summary") return runSummary(store);
+    if (options.command == "generate") return runGenerate(store, options);
+    printUsage(argv[0]);
+    return 1;
+}
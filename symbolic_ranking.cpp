@@ -0,0 +1,200 @@
+#include "symbolic_ranking.h"
+#include "symbolic_leaderboard.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+/*
+ * HISTOGRAM SATU KELOMPOK
+ */
+size_t ScoreRanking::Bucket::find(int32_t score) const {
+    return static_cast<size_t>(lower_bound(scores.begin(), scores.end(), score, greater<int32_t>()) - scores.begin());
+}
+
+void ScoreRanking::Bucket::insert(int32_t score, uint32_t record) {
+    size_t position = find(score);
+    total++;
+    if (position < scores.size() && scores[position] == score) {
+        records[position].push_back(record);
+        if (!stale) {
+            for (size_t i = position + 1; i < tree.size(); i += i & (0 - i)) tree[i]++;
+        }
+        return;
+    }
+    // Skor baru: digabung sekali setelah pemindaian, bukan vector::insert O(k) per skor
+    pending.push_back({score, record});
+    stale = true;
+}
+
+void ScoreRanking::Bucket::mergePending() {
+    // Turun menurut skor lalu naik menurut nomor rekaman (urutan masuk); sort tanpa
+    // buffer sementara agar pembaruan kecil tidak mengalokasikan ulang kelompok
+    sort(pending.begin(), pending.end(), [](const pair<int32_t, uint32_t>& a, const pair<int32_t, uint32_t>& b) {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    });
+    size_t added = 0;
+    for (size_t j = 0; j < pending.size(); j++) added += j == 0 || pending[j].first != pending[j - 1].first;
+
+    // Digabung di tempat dari belakang: skor terkecil lebih dulu, setiap skor lama
+    // digeser paling banyak sekali. Skor tertunda tidak pernah sudah ada di scores.
+    size_t i = scores.size(), out = scores.size() + added, j = pending.size();
+    scores.resize(out);
+    records.resize(out);
+    while (j > 0) {
+        out--;
+        if (i > 0 && scores[i - 1] < pending[j - 1].first) {
+            i--;
+            scores[out] = scores[i];
+            records[out].swap(records[i]);
+            continue;
+        }
+        const int32_t score = pending[j - 1].first;
+        size_t groupEnd = j;
+        while (j > 0 && pending[j - 1].first == score) j--;
+        scores[out] = score;
+        records[out].clear();
+        for (size_t g = j; g < groupEnd; g++) records[out].push_back(pending[g].second);
+    }
+    pending.clear();
+    rebuildTree();
+}
+
+void ScoreRanking::Bucket::rebuildTree() {
+    // Pembangunan O(k): setiap simpul meneruskan jumlahnya ke induknya
+    stale = false;
+    tree.assign(scores.size() + 1, 0);
+    for (size_t i = 1; i < tree.size(); i++) {
+        tree[i] += static_cast<uint32_t>(records[i - 1].size());
+        size_t parent = i + (i & (0 - i));
+        if (parent < tree.size()) tree[parent] += tree[i];
+    }
+}
+
+size_t ScoreRanking::Bucket::countAbove(size_t position) const {
+    size_t count = 0;
+    for (size_t i = position; i > 0; i -= i & (0 - i)) count += tree[i];
+    return count;
+}
+
+/*
+ * INDEKS
+ */
+void ScoreRanking::clear() {
+    buckets.clear();
+    players.clear();
+    generation = 0;
+    scanned = 0;
+}
+
+void ScoreRanking::update(const LeaderboardStore& store) {
+    if (store.getGeneration() != generation || store.recordCount() < scanned) {
+        clear();
+        generation = store.getGeneration();
+    }
+    for (size_t i = scanned; i < store.recordCount(); i++) {
+        if (store.recordValid(i)) insert(*store.recordAt(i), static_cast<uint32_t>(i));
+    }
+    scanned = store.recordCount();
+    for (auto& item : buckets) {
+        if (item.second.stale) item.second.mergePending();
+    }
+}
+
+void ScoreRanking::insert(const ScoreRecord& record, uint32_t recordNumber) {
+    const RankingKey keys[3] = {{record.digits, record.attempts}, {record.digits, 0}, {0, 0}};
+    vector<PlayerBest>& bests = players[string(record.name, strnlen(record.name, sizeof record.name))];
+    for (const RankingKey& key : keys) {
+        buckets[key.packed()].insert(record.score, recordNumber);
+
+        auto best = lower_bound(bests.begin(), bests.end(), key.packed(),
+                                [](const PlayerBest& b, uint64_t packed) { return b.key.packed() < packed; });
+        if (best == bests.end() || best->key.packed() != key.packed()) bests.insert(best, {key, record.score, recordNumber});
+        else if (record.score > best->score) *best = {key, record.score, recordNumber};
+    }
+}
+
+const ScoreRanking::Bucket* ScoreRanking::bucket(RankingKey key) const {
+    auto it = buckets.find(key.packed());
+    return it == buckets.end() ? nullptr : &it->second;
+}
+
+RankInfo ScoreRanking::rank(RankingKey key, int score) const {
+    RankInfo info;
+    const Bucket* b = bucket(key);
+    if (!b || b->total == 0) return info;
+
+    size_t position = b->find(score);
+    size_t higher = b->countAbove(position);
+    info.rank = higher + 1;
+    info.total = b->total;
+    if (position < b->scores.size() && b->scores[position] == score) info.tied = b->records[position].size();
+    info.percentile = 100.0 * static_cast<double>(b->total - higher) / static_cast<double>(b->total);
+    return info;
+}
+
+vector<RankedScore> ScoreRanking::top(RankingKey key, size_t n, size_t offset) const {
+    vector<RankedScore> result;
+    const Bucket* b = bucket(key);
+    if (!b || offset >= b->total) return result;
+
+    // Turun di pohon Fenwick: posisi skor yang memuat rekaman ke-offset, O(log k)
+    size_t position = 0, skip = offset;
+    size_t step = 1;
+    while (step * 2 < b->tree.size()) step *= 2;
+    for (; step > 0; step /= 2) {
+        if (position + step < b->tree.size() && b->tree[position + step] <= skip) {
+            position += step;
+            skip -= b->tree[position];
+        }
+    }
+
+    size_t above = offset - skip;
+    result.reserve(min(n, b->total - offset));
+    for (; position < b->scores.size() && result.size() < n; position++, skip = 0) {
+        const vector<uint32_t>& records = b->records[position];
+        for (size_t i = skip; i < records.size() && result.size() < n; i++) result.push_back({above + 1, records[i]});
+        above += records.size();
+    }
+    return result;
+}
+
+vector<PlayerBest> ScoreRanking::playerBests(const string& name) const {
+    vector<PlayerBest> result;
+    auto it = players.find(name);
+    if (it == players.end()) return result;
+    for (const PlayerBest& best : it->second) {
+        if (best.key.digits > 0 && best.key.attempts > 0) result.push_back(best);
+    }
+    sort(result.begin(), result.end(), [](const PlayerBest& a, const PlayerBest& b) {
+        if (a.score != b.score) return a.score > b.score;
+        return a.record < b.record;
+    });
+    return result;
+}
+
+const PlayerBest* ScoreRanking::findBest(const vector<PlayerBest>& bests, RankingKey key) {
+    auto it = lower_bound(bests.begin(), bests.end(), key.packed(),
+                          [](const PlayerBest& b, uint64_t packed) { return b.key.packed() < packed; });
+    return it != bests.end() && it->key.packed() == key.packed() ? &*it : nullptr;
+}
+
+bool ScoreRanking::playerBest(const string& name, RankingKey key, PlayerBest& best) const {
+    auto it = players.find(name);
+    if (it == players.end()) return false;
+    const PlayerBest* found = findBest(it->second, key);
+    if (found) best = *found;
+    return found != nullptr;
+}
+
+vector<DifficultySummary> ScoreRanking::difficulties() const {
+    vector<DifficultySummary> result;
+    for (const auto& item : buckets) {
+        RankingKey key{static_cast<int>(item.first >> 32), static_cast<int>(static_cast<uint32_t>(item.first))};
+        const Bucket& b = item.second;
+        if (key.digits <= 0 || key.attempts <= 0 || b.total == 0) continue;
+        result.push_back({key, b.total, b.scores.front(), b.records.front().front()});
+    }
+    return result;
+}
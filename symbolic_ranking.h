@@ -0,0 +1,124 @@
+/*
+ * SYMBOLIC NUMBLER - INDEKS PERINGKAT PER TINGKAT KESULITAN
+ *
+ * Log papan peringkat hanya punya satu urutan global menurut skor. Indeks
+ * ini mengelompokkan rekaman per (digit, percobaan) dan menjawab peringkat,
+ * persentil, n teratas dan skor terbaik per pemain tanpa mengurutkan ulang:
+ *
+ *   - setiap kelompok menyimpan histogram skor: daftar skor berbeda (turun)
+ *     dengan nomor rekaman per skor, plus pohon Fenwick atas jumlahnya,
+ *     jadi "berapa skor di atas X" cukup O(log k) untuk k skor berbeda
+ *   - skor biasa hanya satu per (digit, percobaan maksimum, percobaan
+ *     terpakai), tetapi skor speedrun bergantung pada milidetik dan masuk
+ *     ke kelompok yang sama, jadi k bisa tumbuh sebanyak rekaman speedrun
+ *   - karena itu skor baru yang belum ada tidak disisipkan satu per satu
+ *     (O(k) per skor): skor itu dikumpulkan lalu diurutkan dan digabung
+ *     sekali di akhir update(), O(k + p log p) untuk p skor baru, dan pohon
+ *     disusun ulang sekali; rekaman dengan skor yang sudah ada tetap
+ *     O(log k)
+ *   - rekaman dimasukkan ke tiga kelompok: (digit, percobaan), (digit, 0)
+ *     untuk semua percobaan, dan (0, 0) untuk seluruh papan
+ *
+ * Indeks dibangun bertahap dari log: hanya rekaman baru yang dipindai,
+ * dan dibangun ulang jika log ditulis ulang (generasi berubah).
+ */
+#ifndef SYMBOLIC_RANKING_H
+#define SYMBOLIC_RANKING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class LeaderboardStore;
+struct ScoreRecord;
+
+// Kunci kelompok; 0 berarti semua (digits 0 = seluruh papan)
+struct RankingKey {
+    int digits = 0;
+    int attempts = 0;
+
+    uint64_t packed() const { return static_cast<uint64_t>(static_cast<uint32_t>(digits)) << 32 | static_cast<uint32_t>(attempts); }
+};
+
+struct RankInfo {
+    size_t rank = 0;        // 1 = teratas; skor sama berbagi peringkat
+    size_t total = 0;       // Jumlah skor di kelompok
+    size_t tied = 0;        // Skor yang sama persis (termasuk skor itu sendiri jika ada di papan)
+    double percentile = 0;  // Persen skor yang setara atau lebih rendah
+
+    bool found() const { return total > 0; }
+};
+
+struct RankedScore {
+    size_t rank = 0;
+    uint32_t record = 0;    // Nomor rekaman di log
+};
+
+struct PlayerBest {
+    RankingKey key;
+    int score = 0;
+    uint32_t record = 0;
+};
+
+struct DifficultySummary {
+    RankingKey key;
+    size_t total = 0;
+    int bestScore = 0;
+    uint32_t bestRecord = 0;
+};
+
+class ScoreRanking {
+private:
+    // Histogram satu kelompok
+    struct Bucket {
+        std::vector<int32_t> scores;                // Skor berbeda, turun
+        std::vector<std::vector<uint32_t>> records; // Per skor, nomor rekaman naik (urutan masuk)
+        std::vector<uint32_t> tree;                 // Fenwick atas records[i].size()
+        std::vector<std::pair<int32_t, uint32_t>> pending; // Skor baru (skor, rekaman) sejak update() terakhir
+        size_t total = 0;
+        bool stale = false;                         // Digabung dan pohon disusun ulang di akhir update()
+
+        void insert(int32_t score, uint32_t record);
+        void mergePending();
+        void rebuildTree();
+        size_t countAbove(size_t position) const;   // Jumlah rekaman di posisi < position
+        size_t find(int32_t score) const;           // Posisi pertama dengan skor <= score
+    };
+
+    std::map<uint64_t, Bucket> buckets;
+    std::unordered_map<std::string, std::vector<PlayerBest>> players; // Per pemain, urut menurut kunci
+    uint64_t generation = 0;
+    size_t scanned = 0;
+
+    const Bucket* bucket(RankingKey key) const;
+    static const PlayerBest* findBest(const std::vector<PlayerBest>& bests, RankingKey key);
+    void insert(const ScoreRecord& record, uint32_t recordNumber);
+
+public:
+    // Memindai rekaman log yang belum terindeks; dibangun ulang jika log ditulis ulang
+    void update(const LeaderboardStore& store);
+    void clear();
+
+    size_t size() const { return scanned; }
+
+    // Peringkat skor (ada di papan atau tidak) di kelompok key
+    RankInfo rank(RankingKey key, int score) const;
+
+    // n skor tertinggi di kelompok key mulai dari peringkat ke-(offset + 1)
+    std::vector<RankedScore> top(RankingKey key, size_t n, size_t offset = 0) const;
+
+    // Skor terbaik pemain per (digit, percobaan), tertinggi lebih dulu
+    std::vector<PlayerBest> playerBests(const std::string& name) const;
+
+    // Skor terbaik pemain di satu kelompok; false jika belum pernah mencetak skor di sana
+    bool playerBest(const std::string& name, RankingKey key, PlayerBest& best) const;
+
+    // Semua kelompok (digit, percobaan) yang berisi skor, urut menurut digit lalu percobaan
+    std::vector<DifficultySummary> difficulties() const;
+};
+
+#endif
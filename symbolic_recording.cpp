@@ -0,0 +1,598 @@
+#include "symbolic_recording.h"
+#include "symbolic_crc32.h"
+#include "symbolic_fileio.h"
+#include "symbolic_lz.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+constexpr char FILE_MAGIC[8] = {'S', 'Y', 'M', 'R', 'E', 'C', '0', '1'};
+constexpr char INDEX_MAGIC[8] = {'S', 'Y', 'M', 'R', 'I', 'D', 'X', '1'};
+constexpr uint32_t RECORDING_VERSION = 1;
+constexpr uint32_t BLOCK_MAGIC = 0x4B425253; // "SRBK"
+constexpr uint32_t BLOCK_COMPRESSED = 1;
+
+// Tebakan sampai 18 digit muat di uint64 dan dikodekan sebagai selisih
+constexpr int MAX_NUMERIC_DIGITS = 18;
+// Batas kewajaran saat mengurai agar data rusak tidak memicu alokasi raksasa
+constexpr uint64_t MAX_DECODED_ATTEMPTS = 4096;
+constexpr uint64_t MAX_NAME_LENGTH = 255;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+};
+
+struct BlockHeader {
+    uint32_t magic;
+    uint32_t flags;
+    uint32_t rawSize;
+    uint32_t storedSize;
+    uint32_t games;
+    uint32_t checksum; // CRC-32 header (checksum = 0) lalu payload
+    int64_t firstStart;
+    int64_t lastStart;
+};
+
+struct IndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t entrySize;
+};
+
+struct IndexEntry {
+    uint64_t offset;
+    uint32_t storedSize;
+    uint32_t games;
+    int64_t firstStart;
+    int64_t lastStart;
+};
+
+static_assert(sizeof(FileHeader) == 16 && sizeof(IndexHeader) == 16, "header harus 16 byte");
+static_assert(sizeof(BlockHeader) == 40, "BlockHeader harus 40 byte");
+static_assert(sizeof(IndexEntry) == 32, "IndexEntry harus 32 byte");
+
+string indexPathOf(const string& path) {
+    size_t dot = path.rfind('.');
+    return (dot == string::npos ? path : path.substr(0, dot)) + ".rix";
+}
+
+uint32_t blockChecksum(BlockHeader header, const uint8_t* payload) {
+    header.checksum = 0;
+    return crc32(payload, header.storedSize, crc32(&header, sizeof header));
+}
+
+/*
+ * VARINT DAN KODE BASIS 3
+ */
+void putVarint(vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+uint64_t numericValue(const string& digits) {
+    uint64_t value = 0;
+    for (char ch : digits) value = value * 10 + static_cast<uint64_t>(ch - '0');
+    return value;
+}
+
+void putNumber(vector<uint8_t>& out, const string& digits, uint64_t& previous) {
+    if (digits.size() <= static_cast<size_t>(MAX_NUMERIC_DIGITS)) {
+        uint64_t value = numericValue(digits);
+        putVarint(out, zigzag(static_cast<int64_t>(value - previous)));
+        previous = value;
+        return;
+    }
+    // Maraton: nibble mentah, selisih angka ribuan digit tidak lebih kecil
+    PackedDigits packed = PackedDigits::fromString(digits);
+    out.insert(out.end(), packed.data(), packed.data() + packed.byteSize());
+}
+
+uint8_t tritOf(char ch) {
+    return ch == 'G' ? 2 : ch == 'Y' ? 1 : 0;
+}
+
+// Lima posisi per byte: 3^5 = 243 <= 256
+void putFeedback(vector<uint8_t>& out, const string& result) {
+    for (size_t i = 0; i < result.size(); i += 5) {
+        uint8_t code = 0;
+        for (size_t k = min(result.size(), i + 5); k > i; k--) code = static_cast<uint8_t>(code * 3 + tritOf(result[k - 1]));
+        out.push_back(code);
+    }
+}
+
+// Pembaca dengan batas: setiap kegagalan membuat ok = false dan mengembalikan 0
+struct Cursor {
+    const uint8_t* p;
+    const uint8_t* end;
+    bool ok = true;
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (p >= end) break;
+            uint8_t byte = *p++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return value;
+        }
+        ok = false;
+        return 0;
+    }
+
+    const uint8_t* take(size_t size) {
+        if (static_cast<size_t>(end - p) < size) {
+            ok = false;
+            return nullptr;
+        }
+        const uint8_t* start = p;
+        p += size;
+        return start;
+    }
+};
+
+bool takeNumber(Cursor& in, int digits, uint64_t& previous, string& out) {
+    out.resize(static_cast<size_t>(digits));
+    if (digits <= MAX_NUMERIC_DIGITS) {
+        uint64_t value = previous + static_cast<uint64_t>(unzigzag(in.varint()));
+        previous = value;
+        for (int i = digits - 1; i >= 0; i--) {
+            out[static_cast<size_t>(i)] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        return in.ok;
+    }
+    const uint8_t* bytes = in.take((static_cast<size_t>(digits) + 1) / 2);
+    if (!bytes) return false;
+    for (int i = 0; i < digits; i++) {
+        uint8_t nibble = (i & 1) ? (bytes[i >> 1] & 0x0F) : (bytes[i >> 1] >> 4);
+        if (nibble > 9) return false;
+        out[static_cast<size_t>(i)] = static_cast<char>('0' + nibble);
+    }
+    return true;
+}
+
+bool takeFeedback(Cursor& in, int digits, string& out) {
+    size_t size = static_cast<size_t>(digits);
+    const uint8_t* codes = in.take((size + 4) / 5);
+    if (!codes) return false;
+    out.resize(size);
+    for (size_t i = 0; i < size; i += 5) {
+        uint8_t code = codes[i / 5];
+        if (code >= 243) return false;
+        for (size_t k = i; k < min(size, i + 5); k++) {
+            out[k] = FEEDBACK_ALPHABET[code % 3];
+            code /= 3;
+        }
+    }
+    return true;
+}
+
+/*
+ * TATA LETAK SATU PERMAINAN
+ * digits, maxAttempts, flags, selisih startedAt, elapsedMs, skor, nama,
+ * jumlah tebakan, panjang badan, lalu badan: target dan setiap tebakan
+ * (selisih waktu, angka, hasil). Panjang badan membuat ringkasan bisa
+ * melompati tebakan tanpa mengurainya.
+ */
+constexpr uint64_t FLAG_WON = 1;
+constexpr uint64_t FLAG_TIMED = 2;
+constexpr uint64_t FLAG_FINISHED = 4;
+
+bool decodeGame(Cursor& in, int64_t& previousStart, GameRecord& game, bool withGuesses) {
+    uint64_t digits = in.varint();
+    uint64_t maxAttempts = in.varint();
+    uint64_t flags = in.varint();
+    game.startedAt = previousStart + unzigzag(in.varint());
+    previousStart = game.startedAt;
+    game.elapsedMs = static_cast<uint32_t>(in.varint());
+    game.score = static_cast<int>(unzigzag(in.varint()));
+    uint64_t nameLength = in.varint();
+    if (!in.ok || digits == 0 || digits > static_cast<uint64_t>(MARATHON_MAX_DIGITS) || nameLength > MAX_NAME_LENGTH) {
+        return false;
+    }
+    const uint8_t* name = in.take(nameLength);
+    uint64_t attempts = in.varint();
+    uint64_t bodyLength = in.varint();
+    if (!in.ok || attempts > MAX_DECODED_ATTEMPTS) return false;
+
+    game.digits = static_cast<int>(digits);
+    game.maxAttempts = static_cast<int>(maxAttempts);
+    game.attempts = static_cast<int>(attempts);
+    game.won = (flags & FLAG_WON) != 0;
+    game.timed = (flags & FLAG_TIMED) != 0;
+    game.finished = (flags & FLAG_FINISHED) != 0;
+    game.playerName.assign(reinterpret_cast<const char*>(name), nameLength);
+
+    const uint8_t* body = in.take(bodyLength);
+    if (!body) return false;
+    if (!withGuesses) {
+        game.target.clear();
+        game.guesses.clear();
+        game.results.clear();
+        game.guessMs.clear();
+        return true;
+    }
+
+    Cursor part{body, body + bodyLength};
+    uint64_t previousValue = 0;
+    if (!takeNumber(part, game.digits, previousValue, game.target)) return false;
+    previousValue = 0;
+    uint32_t previousMs = 0;
+    game.guesses.resize(attempts);
+    game.results.resize(attempts);
+    game.guessMs.resize(attempts);
+    for (size_t i = 0; i < attempts; i++) {
+        previousMs += static_cast<uint32_t>(part.varint());
+        game.guessMs[i] = previousMs;
+        if (!takeNumber(part, game.digits, previousValue, game.guesses[i])) return false;
+        if (!takeFeedback(part, game.digits, game.results[i])) return false;
+    }
+    return part.ok && part.p == part.end;
+}
+
+// Menutup descriptor saat keluar dari lingkup
+struct FileCloser {
+    int fd;
+    ~FileCloser() {
+        if (fd >= 0) closeFile(fd);
+    }
+};
+
+bool writeHeaderAfterTruncate(int fd, const void* header, size_t size) {
+    return truncateFile(fd, 0) && writeFile(fd, header, size);
+}
+
+bool resetIndex(int indexFd) {
+    IndexHeader header = {};
+    memcpy(header.magic, INDEX_MAGIC, sizeof INDEX_MAGIC);
+    header.version = RECORDING_VERSION;
+    header.entrySize = sizeof(IndexEntry);
+    return writeHeaderAfterTruncate(indexFd, &header, sizeof header);
+}
+
+bool appendIndexEntry(int indexFd, uint64_t offset, const BlockHeader& block) {
+    IndexEntry entry = {offset, block.storedSize, block.games, block.firstStart, block.lastStart};
+    return writeFile(indexFd, &entry, sizeof entry);
+}
+
+/*
+ * Mencari akhir blok sah terakhir di bawah kunci: mulai dari entri indeks
+ * terakhir, blok yang belum terindeks (penulis crash setelah menulis data)
+ * ditambahkan ke indeks dan potongan blok di ekor file dibuang.
+ */
+long long recoverTail(int fd, long long size, int indexFd) {
+    long long end = sizeof(FileHeader);
+    long long indexSize = fileSize(indexFd);
+    IndexHeader indexHeader;
+    bool indexValid = indexSize >= static_cast<long long>(sizeof indexHeader) &&
+                      readFileAt(indexFd, 0, &indexHeader, sizeof indexHeader) &&
+                      memcmp(indexHeader.magic, INDEX_MAGIC, sizeof INDEX_MAGIC) == 0 &&
+                      indexHeader.entrySize == sizeof(IndexEntry);
+    if (!indexValid) {
+        if (!resetIndex(indexFd)) return -1;
+    } else {
+        long long body = indexSize - static_cast<long long>(sizeof indexHeader);
+        long long aligned = body - body % static_cast<long long>(sizeof(IndexEntry));
+        if (aligned != body && !truncateFile(indexFd, sizeof indexHeader + aligned)) return -1;
+        if (aligned > 0) {
+            IndexEntry last;
+            if (!readFileAt(indexFd, sizeof indexHeader + aligned - sizeof last, &last, sizeof last)) return -1;
+            end = static_cast<long long>(last.offset + sizeof(BlockHeader) + last.storedSize);
+            // Indeks menunjuk melewati data (data dipotong dari luar): bangun ulang dari awal
+            if (end > size) {
+                if (!resetIndex(indexFd)) return -1;
+                end = sizeof(FileHeader);
+            }
+        }
+    }
+
+    vector<uint8_t> payload;
+    while (end + static_cast<long long>(sizeof(BlockHeader)) <= size) {
+        BlockHeader header;
+        if (!readFileAt(fd, end, &header, sizeof header) || header.magic != BLOCK_MAGIC) break;
+        long long next = end + static_cast<long long>(sizeof header) + header.storedSize;
+        if (next > size) break;
+        payload.resize(header.storedSize);
+        if (!readFileAt(fd, end + sizeof header, payload.data(), payload.size())) break;
+        if (blockChecksum(header, payload.data()) != header.checksum) break;
+        if (!appendIndexEntry(indexFd, static_cast<uint64_t>(end), header)) return -1;
+        end = next;
+    }
+    if (end != size && !truncateFile(fd, end)) return -1;
+    return end;
+}
+
+} // namespace
+
+int64_t recordingNowMs() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+}
+
+void fillGameRecord(GameRecord& record, const GameCore& core) {
+    record.digits = core.getDigits();
+    record.maxAttempts = core.getMaxAttempts();
+    record.attempts = static_cast<int>(core.getGuessCount());
+    record.won = core.isWon();
+    record.finished = core.isOver();
+    record.target = core.getTarget();
+    record.guesses.resize(core.getGuessCount());
+    record.results.resize(core.getGuessCount());
+    for (size_t i = 0; i < core.getGuessCount(); i++) {
+        record.guesses[i] = core.getGuess(i);
+        record.results[i] = core.getResult(i);
+    }
+}
+
+/*
+ * PENULIS
+ */
+RecordingWriter::RecordingWriter(const string& path) : dataPath(path), indexPath(indexPathOf(path)) {}
+
+RecordingWriter::~RecordingWriter() {
+    {
+        lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (worker.joinable()) worker.join();
+}
+
+void RecordingWriter::record(GameRecord game) {
+    {
+        lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::move(game));
+        // Thread dibuat saat permainan pertama direkam, bukan saat program mulai
+        if (!worker.joinable()) worker = thread(&RecordingWriter::run, this);
+    }
+    wake.notify_one();
+}
+
+void RecordingWriter::flush() {
+    unique_lock<std::mutex> lock(mutex);
+    if (!worker.joinable()) return;
+    uint64_t ticket = ++flushRequested;
+    wake.notify_one();
+    flushed.wait(lock, [&] { return flushCompleted >= ticket; });
+}
+
+void RecordingWriter::run() {
+    unique_lock<std::mutex> lock(mutex);
+    auto ready = [this] { return !queue.empty() || stopping || flushRequested > flushCompleted; };
+    while (true) {
+        if (!ready()) {
+            if (pendingGames == 0) {
+                wake.wait(lock, ready);
+            } else if (!wake.wait_for(lock, chrono::milliseconds(FLUSH_DELAY_MS), ready)) {
+                // Tidak ada permainan baru: blok yang belum penuh ditulis juga
+                lock.unlock();
+                writeBlock();
+                lock.lock();
+                continue;
+            }
+        }
+
+        batch.swap(queue);
+        bool stop = stopping;
+        uint64_t flushTicket = flushRequested;
+        lock.unlock();
+
+        for (const GameRecord& game : batch) {
+            encode(game);
+            if (pending.size() >= BLOCK_BYTES) writeBlock();
+        }
+        batch.clear();
+        if (stop || flushTicket > flushCompleted) writeBlock();
+
+        lock.lock();
+        if (flushTicket > flushCompleted) {
+            flushCompleted = flushTicket;
+            flushed.notify_all();
+        }
+        if (stop && queue.empty()) return;
+    }
+}
+
+void RecordingWriter::encode(const GameRecord& game) {
+    if (pendingGames == 0) {
+        previousStart = 0;
+        firstStart = lastStart = game.startedAt;
+    }
+    firstStart = min(firstStart, game.startedAt);
+    lastStart = max(lastStart, game.startedAt);
+
+    body.clear();
+    uint64_t previousValue = 0;
+    putNumber(body, game.target, previousValue);
+    previousValue = 0;
+    uint32_t previousMs = 0;
+    size_t attempts = min(game.guesses.size(), game.results.size());
+    for (size_t i = 0; i < attempts; i++) {
+        uint32_t at = i < game.guessMs.size() ? max(game.guessMs[i], previousMs) : previousMs;
+        putVarint(body, at - previousMs);
+        previousMs = at;
+        putNumber(body, game.guesses[i], previousValue);
+        putFeedback(body, game.results[i]);
+    }
+
+    uint64_t flags = (game.won ? FLAG_WON : 0) | (game.timed ? FLAG_TIMED : 0) | (game.finished ? FLAG_FINISHED : 0);
+    size_t nameLength = min(game.playerName.size(), static_cast<size_t>(MAX_NAME_LENGTH));
+    putVarint(pending, static_cast<uint64_t>(game.digits));
+    putVarint(pending, static_cast<uint64_t>(game.maxAttempts));
+    putVarint(pending, flags);
+    putVarint(pending, zigzag(game.startedAt - previousStart));
+    putVarint(pending, game.elapsedMs);
+    putVarint(pending, zigzag(game.score));
+    putVarint(pending, nameLength);
+    pending.insert(pending.end(), game.playerName.begin(), game.playerName.begin() + static_cast<ptrdiff_t>(nameLength));
+    putVarint(pending, attempts);
+    putVarint(pending, body.size());
+    pending.insert(pending.end(), body.begin(), body.end());
+
+    previousStart = game.startedAt;
+    pendingGames++;
+}
+
+bool RecordingWriter::writeBlock() {
+    if (pendingGames == 0) return true;
+
+    lzCompress(pending.data(), pending.size(), compressed);
+    bool packed = compressed.size() < pending.size();
+    const vector<uint8_t>& payload = packed ? compressed : pending;
+
+    BlockHeader header = {};
+    header.magic = BLOCK_MAGIC;
+    header.flags = packed ? BLOCK_COMPRESSED : 0;
+    header.rawSize = static_cast<uint32_t>(pending.size());
+    header.storedSize = static_cast<uint32_t>(payload.size());
+    header.games = pendingGames;
+    header.firstStart = firstStart;
+    header.lastStart = lastStart;
+    header.checksum = blockChecksum(header, payload.data());
+
+    bool written = false;
+    {
+        LockedLog log;
+        if (log.open(dataPath)) {
+            int fd = log.get();
+            FileCloser index{openFile(indexPath, true)};
+            long long size = fileSize(fd);
+            long long end = -1;
+            if (index.fd >= 0 && size >= 0) {
+                FileHeader fileHeader;
+                if (size < static_cast<long long>(sizeof fileHeader)) {
+                    // File baru (atau header belum lengkap)
+                    memset(&fileHeader, 0, sizeof fileHeader);
+                    memcpy(fileHeader.magic, FILE_MAGIC, sizeof FILE_MAGIC);
+                    fileHeader.version = RECORDING_VERSION;
+                    if (writeHeaderAfterTruncate(fd, &fileHeader, sizeof fileHeader) && resetIndex(index.fd)) {
+                        end = sizeof fileHeader;
+                    }
+                } else if (readFileAt(fd, 0, &fileHeader, sizeof fileHeader) &&
+                           memcmp(fileHeader.magic, FILE_MAGIC, sizeof FILE_MAGIC) == 0) {
+                    end = recoverTail(fd, size, index.fd);
+                }
+                // Selain itu bukan file rekaman: jangan ditimpa
+            }
+            // Indeks ditulis setelah data di-fsync; indeks yang tertinggal diperbaiki penulis berikutnya
+            written = end >= 0 && writeFile(fd, &header, sizeof header) &&
+                      writeFile(fd, payload.data(), payload.size()) && syncFile(fd) &&
+                      appendIndexEntry(index.fd, static_cast<uint64_t>(end), header);
+        }
+    }
+
+    if (written) {
+        gamesWritten.fetch_add(pendingGames, memory_order_relaxed);
+        blocksWritten.fetch_add(1, memory_order_relaxed);
+    } else {
+        writeErrors.fetch_add(1, memory_order_relaxed);
+    }
+    // Blok yang gagal dibuang agar antrean tidak tumbuh tanpa batas saat disk bermasalah
+    pending.clear();
+    pendingGames = 0;
+    return written;
+}
+
+/*
+ * PEMBACA
+ */
+bool RecordingReader::addBlock(uint64_t offset) {
+    if (offset + sizeof(BlockHeader) > file.size()) return false;
+    BlockHeader header;
+    memcpy(&header, file.data() + offset, sizeof header);
+    if (header.magic != BLOCK_MAGIC || offset + sizeof header + header.storedSize > file.size()) return false;
+    blocks.push_back({offset, header.storedSize, header.games, games, header.firstStart, header.lastStart});
+    games += header.games;
+    return true;
+}
+
+bool RecordingReader::open(const string& path) {
+    blocks.clear();
+    games = 0;
+    indexedBlocks = 0;
+    if (!file.open(path)) return false;
+    if (file.size() == 0) return true;
+    if (file.size() < sizeof(FileHeader) || memcmp(file.data(), FILE_MAGIC, sizeof FILE_MAGIC) != 0) return false;
+
+    // Entri indeks dipercaya selama berurutan dan masih di dalam file; header blok
+    // diperiksa saat blok diurai, jadi membuka log besar tidak menyentuh setiap blok
+    uint64_t end = sizeof(FileHeader);
+    MappedFile index;
+    if (index.open(indexPathOf(path)) && index.size() >= sizeof(IndexHeader)) {
+        IndexHeader header;
+        memcpy(&header, index.data(), sizeof header);
+        if (memcmp(header.magic, INDEX_MAGIC, sizeof INDEX_MAGIC) == 0 && header.entrySize == sizeof(IndexEntry)) {
+            size_t count = (index.size() - sizeof header) / sizeof(IndexEntry);
+            blocks.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                IndexEntry entry;
+                memcpy(&entry, index.data() + sizeof header + i * sizeof entry, sizeof entry);
+                uint64_t next = entry.offset + sizeof(BlockHeader) + entry.storedSize;
+                if (entry.offset != end || next > file.size()) break;
+                blocks.push_back({entry.offset, entry.storedSize, entry.games, games, entry.firstStart, entry.lastStart});
+                games += entry.games;
+                end = next;
+            }
+            indexedBlocks = blocks.size();
+        }
+    }
+
+    while (addBlock(end)) end = blocks.back().offset + sizeof(BlockHeader) + blocks.back().storedSize;
+    return true;
+}
+
+bool RecordingReader::decodeBlock(size_t i, vector<uint8_t>& buffer, vector<GameRecord>& out, bool withGuesses) const {
+    const RecordingBlock& block = blocks[i];
+    BlockHeader header;
+    memcpy(&header, file.data() + block.offset, sizeof header);
+    const uint8_t* payload = file.data() + block.offset + sizeof header;
+    if (header.magic != BLOCK_MAGIC || header.storedSize != block.storedSize || header.games != block.games ||
+        blockChecksum(header, payload) != header.checksum) {
+        return false;
+    }
+
+    const uint8_t* raw = payload;
+    if (header.flags & BLOCK_COMPRESSED) {
+        buffer.resize(header.rawSize);
+        if (!lzDecompress(payload, header.storedSize, buffer.data(), buffer.size())) return false;
+        raw = buffer.data();
+    } else if (header.rawSize != header.storedSize) {
+        return false;
+    }
+
+    out.resize(header.games);
+    Cursor in{raw, raw + header.rawSize};
+    int64_t previousStart = 0;
+    for (GameRecord& game : out) {
+        if (!decodeGame(in, previousStart, game, withGuesses)) return false;
+    }
+    return in.p == in.end;
+}
+
+bool RecordingReader::readGame(uint64_t number, GameRecord& out) const {
+    if (number >= games) return false;
+    auto after = upper_bound(blocks.begin(), blocks.end(), number,
+                             [](uint64_t n, const RecordingBlock& block) { return n < block.firstGame; });
+    size_t i = static_cast<size_t>(after - blocks.begin()) - 1;
+    vector<uint8_t> buffer;
+    vector<GameRecord> decoded;
+    if (!decodeBlock(i, buffer, decoded)) return false;
+    out = std::move(decoded[number - blocks[i].firstGame]);
+    return true;
+}
@@ -0,0 +1,148 @@
+/*
+ * SYMBOLIC NUMBLER - REKAMAN PERMAINAN BINER
+ *
+ * Setiap permainan (pengaturan, target, tebakan, hasil dan waktu) disimpan
+ * ke log biner hanya-tambah. Permainan dikodekan dengan varint: tebakan
+ * sebagai selisih dari tebakan sebelumnya (zigzag), hasil sebagai kode
+ * basis 3 (lima posisi per byte). Permainan dikumpulkan menjadi blok yang
+ * dikompresi LZ dan diberi CRC-32; file indeks mencatat offset setiap blok
+ * sehingga pembaca bisa melompat langsung ke permainan ke-n.
+ *
+ *   symbolic_games.rec  header + (BlockHeader + payload)[]
+ *   symbolic_games.rix  header + IndexEntry[]
+ *
+ * Penulisan dikerjakan thread latar belakang: jalur interaktif hanya
+ * memindahkan rekaman ke antrean. Beberapa proses boleh menulis ke file
+ * yang sama; setiap blok ditambahkan di bawah flock.
+ */
+#ifndef SYMBOLIC_RECORDING_H
+#define SYMBOLIC_RECORDING_H
+
+#include "symbolic_core.h"
+#include "symbolic_mmap.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Satu permainan lengkap
+struct GameRecord {
+    int digits = 0;
+    int maxAttempts = 0;
+    int attempts = 0;          // Jumlah tebakan (terisi juga saat tebakan tidak diurai)
+    bool won = false;
+    bool timed = false;
+    bool finished = false;     // false jika pemain keluar di tengah permainan
+    int64_t startedAt = 0;     // Milidetik sejak epoch saat papan pertama muncul
+    uint32_t elapsedMs = 0;    // Sampai tebakan terakhir
+    int score = 0;             // 0 jika tidak menang
+    std::string playerName;    // Kosong jika tidak masuk papan peringkat
+    std::string target;
+    std::vector<std::string> guesses;
+    std::vector<std::string> results; // G/Y/X seperti evaluateGuess
+    std::vector<uint32_t> guessMs;    // Waktu setiap tebakan sejak papan muncul
+};
+
+// Milidetik sejak epoch untuk GameRecord::startedAt
+int64_t recordingNowMs();
+
+// Mengisi pengaturan, target, tebakan dan hasil dari GameCore; waktu, skor dan nama diisi pemanggil
+void fillGameRecord(GameRecord& record, const GameCore& core);
+
+// Satu blok di file rekaman
+struct RecordingBlock {
+    uint64_t offset;     // Posisi BlockHeader di file
+    uint32_t storedSize; // Ukuran payload di file
+    uint32_t games;
+    uint64_t firstGame;  // Nomor permainan pertama di blok
+    int64_t firstStart;  // startedAt terkecil dan terbesar di blok
+    int64_t lastStart;
+};
+
+class RecordingWriter {
+private:
+    std::string dataPath;
+    std::string indexPath;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<GameRecord> queue;
+    bool stopping = false;
+    uint64_t flushRequested = 0;
+    uint64_t flushCompleted = 0;
+    std::condition_variable flushed;
+    std::thread worker;
+
+    // Hanya disentuh thread penulis
+    std::vector<GameRecord> batch;  // Antrean yang sedang dikodekan (kapasitas dipakai ulang)
+    std::vector<uint8_t> pending;   // Permainan terkode yang belum ditulis
+    std::vector<uint8_t> body;
+    std::vector<uint8_t> compressed;
+    uint32_t pendingGames = 0;
+    int64_t previousStart = 0;
+    int64_t firstStart = 0;
+    int64_t lastStart = 0;
+
+    std::atomic<uint64_t> gamesWritten{0};
+    std::atomic<uint64_t> blocksWritten{0};
+    std::atomic<uint64_t> writeErrors{0};
+
+    void run();
+    void encode(const GameRecord& game);
+    bool writeBlock();
+
+public:
+    // Blok ditulis saat mencapai ukuran ini atau setelah FLUSH_DELAY_MS tanpa permainan baru
+    static constexpr size_t BLOCK_BYTES = 64 * 1024;
+    static constexpr int FLUSH_DELAY_MS = 1000;
+
+    explicit RecordingWriter(const std::string& path = "symbolic_games.rec");
+    ~RecordingWriter(); // Menulis sisa antrean sebelum kembali
+    RecordingWriter(const RecordingWriter&) = delete;
+    RecordingWriter& operator=(const RecordingWriter&) = delete;
+
+    // Aman dari banyak thread; tidak pernah menunggu disk
+    void record(GameRecord game);
+
+    // Menunggu sampai semua permainan di antrean tertulis ke disk
+    void flush();
+
+    const std::string& getPath() const { return dataPath; }
+    uint64_t getGamesWritten() const { return gamesWritten.load(std::memory_order_relaxed); }
+    uint64_t getBlocksWritten() const { return blocksWritten.load(std::memory_order_relaxed); }
+    uint64_t getWriteErrors() const { return writeErrors.load(std::memory_order_relaxed); }
+};
+
+class RecordingReader {
+private:
+    MappedFile file;
+    std::vector<RecordingBlock> blocks;
+    uint64_t games = 0;
+    size_t indexedBlocks = 0; // Blok yang ditemukan lewat indeks (sisanya dipindai)
+
+    bool addBlock(uint64_t offset);
+
+public:
+    // Memetakan file rekaman; blok setelah indeks (atau tanpa indeks) dicari dengan memindai header
+    bool open(const std::string& path = "symbolic_games.rec");
+
+    size_t blockCount() const { return blocks.size(); }
+    const RecordingBlock& block(size_t i) const { return blocks[i]; }
+    uint64_t gameCount() const { return games; }
+    size_t getIndexedBlocks() const { return indexedBlocks; }
+    size_t getFileSize() const { return file.size(); }
+
+    // Membongkar blok ke buffer (dipakai ulang) lalu mengurai permainannya ke out.
+    // Tanpa withGuesses hanya ringkasan (pengaturan, waktu, skor, nama) yang diurai.
+    bool decodeBlock(size_t i, std::vector<uint8_t>& buffer, std::vector<GameRecord>& out, bool withGuesses = true) const;
+
+    // Permainan ke-number (mulai 0) lewat pencarian biner di daftar blok
+    bool readGame(uint64_t number, GameRecord& out) const;
+};
+
+#endif
@@ -0,0 +1,124 @@
+#include "symbolic_render.h"
+#include "symbolic_alloc.h"
+#include "symbolic_trace.h"
+
+using namespace std;
+
+BoardPresenter::BoardPresenter(Sink output) : sink(std::move(output)) {}
+
+BoardPresenter::~BoardPresenter() {
+    if (!worker.joinable()) return;
+    {
+        lock_guard<mutex> lock(wakeMutex);
+        stopping.store(true);
+    }
+    wake.notify_one();
+    worker.join();
+}
+
+void BoardPresenter::publish() {
+    // Thread dimulai saat snapshot pertama, seperti penulis rekaman
+    if (!worker.joinable()) worker = thread(&BoardPresenter::run, this);
+
+    uint64_t seq = publishedSeq.load(memory_order_relaxed) + 1;
+    exchange.back().seq = seq;
+    publishedSeq.store(seq, memory_order_relaxed);
+    exchange.publish();
+
+    // Dekker dengan run(): publish di atas lalu membaca sleeping, run menulis sleeping lalu membaca hasFresh
+    atomic_thread_fence(memory_order_seq_cst);
+    if (sleeping.load(memory_order_relaxed)) {
+        lock_guard<mutex> lock(wakeMutex);
+        wake.notify_one();
+    }
+}
+
+void BoardPresenter::keyPressed(Clock::time_point at) {
+    if (!keys.push({publishedSeq.load(memory_order_relaxed) + 1, at})) {
+        keysLost.fetch_add(1, memory_order_relaxed);
+    }
+}
+
+void BoardPresenter::waitIdle() {
+    if (!worker.joinable()) return;
+    unique_lock<mutex> lock(wakeMutex);
+    drawn.wait(lock, [&] {
+        return drawnSeq.load(memory_order_acquire) >= publishedSeq.load(memory_order_relaxed);
+    });
+}
+
+RenderCounters BoardPresenter::counters() const {
+    RenderCounters result;
+    result.published = publishedSeq.load(memory_order_relaxed);
+    result.frames = frames.load(memory_order_relaxed);
+    result.coalesced = coalesced.load(memory_order_relaxed);
+    result.dropped = dropped.load(memory_order_relaxed);
+    result.bytes = bytes.load(memory_order_relaxed);
+    result.keysLost = keysLost.load(memory_order_relaxed);
+    return result;
+}
+
+void BoardPresenter::run() {
+    while (true) {
+        const BoardSnapshot* snapshot = exchange.take();
+        if (snapshot) {
+            draw(*snapshot);
+            continue;
+        }
+
+        unique_lock<mutex> lock(wakeMutex);
+        sleeping.store(true, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        wake.wait(lock, [&] { return exchange.hasFresh() || stopping.load(); });
+        sleeping.store(false, memory_order_relaxed);
+        if (stopping.load() && !exchange.hasFresh()) return;
+    }
+}
+
+void BoardPresenter::draw(const BoardSnapshot& snapshot) {
+    SYMBOLIC_ALLOC_SCOPE(AllocPhase::RENDER);
+    // Status di antara dua frame tidak pernah tampil
+    if (snapshot.seq > lastDrawn + 1) {
+        coalesced.fetch_add(1, memory_order_relaxed);
+        dropped.fetch_add(snapshot.seq - lastDrawn - 1, memory_order_relaxed);
+    }
+    lastDrawn = snapshot.seq;
+
+    if (invalidated.exchange(false, memory_order_relaxed)) screen.invalidate();
+    screen.setHeight(static_cast<size_t>(snapshot.rows));
+    if (snapshot.core.getDigits() != configuredDigits || snapshot.columns != configuredColumns) {
+        configuredDigits = snapshot.core.getDigits();
+        configuredColumns = snapshot.columns;
+        board.configure(configuredDigits, configuredColumns);
+    }
+
+    screen.beginFrame();
+    board.displayBoard(snapshot.core, snapshot.elapsedMs, snapshot.remaining);
+    board.displayGuessInput(snapshot.input, snapshot.hintText, snapshot.hintKey, snapshot.candidatesKey);
+    if (snapshot.showLatency) {
+        RenderCounters stats = counters();
+        board.displayTraceOverlay("Render: " + to_string(stats.frames) + " frame, " + to_string(stats.coalesced) +
+                                  " digabung, " + to_string(stats.dropped) + " status dilewati");
+    }
+    const string& frame = screen.composeFrame();
+    {
+        SYMBOLIC_TRACE_SCOPE(TracePhase::FLUSH);
+        sink(frame);
+    }
+    frames.fetch_add(1, memory_order_relaxed);
+    bytes.fetch_add(frame.size(), memory_order_relaxed);
+
+    // Semua tombol sampai snapshot ini sekarang terlihat
+    Clock::time_point shown = Clock::now();
+    while (const KeyStamp* key = keys.front()) {
+        if (key->seq > snapshot.seq) break;
+        traceRecord(TracePhase::FRAME, key->at, shown);
+        keys.pop();
+    }
+
+    {
+        lock_guard<mutex> lock(wakeMutex);
+        drawnSeq.store(snapshot.seq, memory_order_release);
+    }
+    drawn.notify_all();
+}
@@ -0,0 +1,193 @@
+/*
+ * SYMBOLIC NUMBLER - THREAD RENDER DENGAN SNAPSHOT BEBAS KUNCI
+ *
+ * Thread input/logika mengisi satu BoardSnapshot (salinan status papan)
+ * lalu menyerahkannya lewat triple buffer satu produsen/satu konsumen:
+ * publish() hanya menukar indeks secara atomik dan tidak pernah menunggu
+ * terminal. Thread render selalu mengambil snapshot terbaru; status di
+ * antaranya yang belum sempat digambar digabung (tidak pernah tampil),
+ * jadi terminal yang lambat (SSH, emulator lambat) hanya menurunkan
+ * jumlah frame, bukan menahan tombol.
+ *
+ * Cap waktu tombol dikirim lewat antrean cincin SPSC terpisah beserta
+ * nomor snapshot yang memuatnya, sehingga latensi tombol-ke-frame tetap
+ * terukur walaupun snapshot-nya digabung.
+ */
+#ifndef SYMBOLIC_RENDER_H
+#define SYMBOLIC_RENDER_H
+
+#include "symbolic_board.h"
+#include "symbolic_core.h"
+#include "symbolic_screen.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*
+ * TRIPLE BUFFER SPSC
+ * Produsen menulis ke back(), konsumen membaca slot hasil take(). Slot
+ * tengah dan bit "baru" berada dalam satu byte atomik.
+ */
+template <typename T>
+class SnapshotExchange {
+private:
+    static constexpr uint8_t FRESH = 4;
+
+    struct alignas(64) Slot {
+        T value;
+    };
+    Slot slots[3];
+    alignas(64) std::atomic<uint8_t> middle{1};
+    alignas(64) uint8_t backIndex = 0; // Milik produsen
+    alignas(64) uint8_t frontIndex = 2; // Milik konsumen
+
+public:
+    // Slot milik produsen; isinya sisa snapshot lama, jadi semua bidang harus ditulis ulang
+    T& back() { return slots[backIndex].value; }
+
+    // Menyerahkan back(); true jika snapshot sebelumnya belum diambil (tergantikan)
+    bool publish() {
+        uint8_t old = middle.exchange(static_cast<uint8_t>(backIndex | FRESH), std::memory_order_acq_rel);
+        backIndex = old & 3;
+        return (old & FRESH) != 0;
+    }
+
+    bool hasFresh() const { return (middle.load(std::memory_order_acquire) & FRESH) != 0; }
+
+    // Snapshot terbaru jika ada yang baru sejak take() terakhir, selain itu nullptr
+    const T* take() {
+        if (!hasFresh()) return nullptr;
+        uint8_t old = middle.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = old & 3;
+        return &slots[frontIndex].value;
+    }
+};
+
+/*
+ * ANTREAN CINCIN SPSC (kapasitas pangkat dua)
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+private:
+    static_assert((Capacity & (Capacity - 1)) == 0, "Kapasitas harus pangkat dua");
+    T items[Capacity];
+    alignas(64) std::atomic<size_t> head{0}; // Ditulis konsumen
+    alignas(64) std::atomic<size_t> tail{0}; // Ditulis produsen
+
+public:
+    // false jika penuh
+    bool push(const T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == Capacity) return false;
+        items[t & (Capacity - 1)] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Elemen terdepan tanpa mengambilnya; nullptr jika kosong
+    const T* front() const {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return nullptr;
+        return &items[h & (Capacity - 1)];
+    }
+
+    void pop() { head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+};
+
+// Semua yang dibutuhkan untuk menggambar papan saat menebak
+struct BoardSnapshot {
+    GameCore core;
+    std::string input;
+    std::string hintText;
+    int64_t elapsedMs = -1;   // >= 0: mode speedrun
+    int64_t remaining = -1;   // >= 0: jumlah angka yang masih mungkin
+    int columns = 0;
+    int rows = 0;             // Tinggi terminal, 0 jika tidak diketahui
+    bool hintKey = false;
+    bool candidatesKey = false;
+    bool showLatency = false;
+    uint64_t seq = 0;         // Diisi oleh publish()
+};
+
+struct RenderCounters {
+    uint64_t published = 0; // Snapshot yang diserahkan
+    uint64_t frames = 0;    // Frame yang ditulis ke terminal
+    uint64_t coalesced = 0; // Frame yang mewakili lebih dari satu snapshot
+    uint64_t dropped = 0;   // Snapshot yang tergantikan sebelum sempat digambar
+    uint64_t bytes = 0;
+    uint64_t keysLost = 0;  // Cap waktu tombol yang tidak muat di antrean
+};
+
+class BoardPresenter {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Sink = std::function<void(const std::string&)>;
+
+private:
+    static constexpr size_t KEY_CAPACITY = 1024;
+    struct KeyStamp {
+        uint64_t seq;
+        Clock::time_point at;
+    };
+
+    Sink sink;
+    SnapshotExchange<BoardSnapshot> exchange;
+    SpscRing<KeyStamp, KEY_CAPACITY> keys;
+
+    // Dipakai thread render saja
+    ScreenBuffer screen;
+    BoardRenderer board{screen};
+    int configuredDigits = -1;
+    int configuredColumns = -1;
+    uint64_t lastDrawn = 0;
+
+    // Kunci hanya untuk tidur/bangun, bukan untuk data snapshot
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::condition_variable drawn;
+    std::atomic<bool> sleeping{false};
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> invalidated{false};
+    std::thread worker;
+
+    std::atomic<uint64_t> publishedSeq{0}; // Hanya ditulis produsen
+    std::atomic<uint64_t> drawnSeq{0};
+    std::atomic<uint64_t> frames{0}, coalesced{0}, dropped{0}, bytes{0}, keysLost{0};
+
+    void run();
+    void draw(const BoardSnapshot& snapshot);
+
+public:
+    // Bawaan menulis ke stdout dengan writeTerminal; bench memakai sink sendiri
+    explicit BoardPresenter(Sink output = writeTerminal);
+    ~BoardPresenter();
+    BoardPresenter(const BoardPresenter&) = delete;
+    BoardPresenter& operator=(const BoardPresenter&) = delete;
+
+    // PRODUSEN (satu thread): isi next() sepenuhnya, lalu publish()
+    BoardSnapshot& next() { return exchange.back(); }
+    void publish();
+
+    // Tombol yang tiba pada at akan terlihat di snapshot berikutnya (jejak keyToFrame)
+    void keyPressed(Clock::time_point at);
+
+    // Frame berikutnya digambar ulang penuh (output lain menimpa layar)
+    void invalidate() { invalidated.store(true, std::memory_order_relaxed); }
+
+    // Frame papan juga disiarkan; dipanggil sebelum publish() pertama
+    void setBroadcast(BroadcastPublisher* publisher) { screen.setBroadcast(publisher); }
+
+    // Menunggu snapshot terakhir selesai ditulis; dipanggil sebelum thread lain menulis ke terminal
+    void waitIdle();
+
+    RenderCounters counters() const;
+};
+
+#endif
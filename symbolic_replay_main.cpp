@@ -0,0 +1,418 @@
+/*
+ * SYMBOLIC NUMBLER - PEMUTAR ULANG DAN ANALISIS REKAMAN
+ *
+ * Contoh:
+ *   symbolic_replay list --count 50
+ *   symbolic_replay show 1234 --speed 4
+ *   symbolic_replay stats --threads 8
+ *   symbolic_replay generate --games 1000000 --strategy consistent
+ */
+#include "symbolic_board.h"
+#include "symbolic_recording.h"
+#include "symbolic_screen.h"
+#include "symbolic_strategy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+struct Options {
+    string command;
+    string file = "symbolic_games.rec";
+    uint64_t game = 0;
+    uint64_t from = UINT64_MAX; // Bawaan list: permainan terakhir
+    uint64_t count = 20;
+    double speed = 1.0;
+    unsigned threads = 0;
+    bool full = false;
+    size_t top = 10;
+    uint64_t games = 100000;
+    int digits = 4;
+    int attempts = 6;
+    string strategy = "consistent";
+    uint64_t seed = 1;
+};
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " <perintah> [opsi]\n"
+         << "Perintah:\n"
+         << "  list            Daftar permainan (--from N, --count N; bawaan 20 terakhir)\n"
+         << "  show N          Memutar ulang permainan ke-N (--speed X, 0 = langsung)\n"
+         << "  stats           Statistik pemain dan tingkat kesulitan (--threads N, --top N,\n"
+         << "                  --full juga mengurai setiap tebakan)\n"
+         << "  generate        Merekam permainan simulasi untuk uji coba (--games N, --digits N,\n"
+         << "                  --attempts N, --strategy S, --seed N)\n"
+         << "Opsi umum:\n"
+         << "  --file F        File rekaman (bawaan: symbolic_games.rec)\n";
+}
+
+string formatTime(int64_t ms) {
+    time_t seconds = static_cast<time_t>(ms / 1000);
+    tm local = {};
+#ifdef _WIN32
+    localtime_s(&local, &seconds);
+#else
+    localtime_r(&seconds, &local);
+#endif
+    char text[32];
+    strftime(text, sizeof text, "%Y-%m-%d %H:%M:%S", &local);
+    return text;
+}
+
+const char* outcomeOf(const GameRecord& game) {
+    return game.won ? "menang" : game.finished ? "kalah" : "keluar";
+}
+
+/*
+ * LIST
+ */
+int runList(const RecordingReader& reader, const Options& options) {
+    uint64_t total = reader.gameCount();
+    uint64_t from = options.from != UINT64_MAX ? options.from : total - min(total, options.count);
+    uint64_t to = min(total, from + options.count);
+    cout << total << " permainan di " << reader.blockCount() << " blok (" << reader.getFileSize() << " byte)\n\n";
+    cout << setw(8) << "#" << "  " << setw(19) << "Mulai" << "  " << setw(6) << "Digit" << "  " << setw(6) << "Hasil"
+         << "  " << setw(7) << "Tebakan" << "  " << setw(9) << "Waktu" << "  " << setw(6) << "Skor" << "  Nama\n";
+
+    vector<uint8_t> buffer;
+    vector<GameRecord> decoded;
+    size_t loadedBlock = SIZE_MAX;
+    for (uint64_t n = from; n < to; n++) {
+        // Permainan berurutan berada di blok yang sama: satu kali urai per blok
+        size_t block = loadedBlock;
+        if (block == SIZE_MAX || n >= reader.block(block).firstGame + reader.block(block).games) {
+            block = 0;
+            while (block + 1 < reader.blockCount() && reader.block(block + 1).firstGame <= n) block++;
+            if (!reader.decodeBlock(block, buffer, decoded, false)) {
+                cerr << "Blok " << block << " rusak.\n";
+                return 1;
+            }
+            loadedBlock = block;
+        }
+        const GameRecord& game = decoded[n - reader.block(block).firstGame];
+        cout << setw(8) << n << "  " << setw(19) << formatTime(game.startedAt) << "  " << setw(6)
+             << (to_string(game.digits) + "/" + to_string(game.maxAttempts)) << "  " << setw(6) << outcomeOf(game)
+             << "  " << setw(7) << game.attempts << "  " << setw(7) << game.elapsedMs / 1000 << "." << setw(1)
+             << (game.elapsedMs / 100) % 10 << "  " << setw(6) << game.score << "  " << game.playerName << "\n";
+    }
+    return 0;
+}
+
+/*
+ * SHOW: papan digambar ulang dengan renderer yang sama seperti saat bermain
+ */
+int runShow(const RecordingReader& reader, const Options& options) {
+    GameRecord game;
+    if (!reader.readGame(options.game, game)) {
+        cerr << "Permainan " << options.game << " tidak ada atau rusak.\n";
+        return 1;
+    }
+
+    ScreenBuffer screen;
+    BoardRenderer board(screen);
+    const char* columns = getenv("COLUMNS");
+    const char* lines = getenv("LINES");
+    board.configure(game.digits, columns ? atoi(columns) : 0);
+    screen.setHeight(lines ? static_cast<size_t>(max(0, atoi(lines))) : 0);
+    GameCore core;
+    core.startNewGame(game.digits, game.maxAttempts, game.target);
+
+    auto draw = [&](int64_t elapsed) {
+        screen.beginFrame();
+        board.displayBoard(core, game.timed ? elapsed : -1);
+        screen.addLine("Pemutaran ulang #" + to_string(options.game) + " - " + formatTime(game.startedAt) +
+                       (game.playerName.empty() ? "" : " - " + game.playerName));
+        screen.present();
+    };
+
+    uint32_t previousMs = 0;
+    draw(0);
+    for (int i = 0; i < game.attempts; i++) {
+        uint32_t at = game.guessMs[i];
+        if (options.speed > 0) {
+            this_thread::sleep_for(chrono::duration<double, milli>((at - previousMs) / options.speed));
+        }
+        previousMs = at;
+        core.submitGuess(game.guesses[i]);
+        // Hasil dihitung ulang; beda berarti aturan evaluasi berubah sejak direkam
+        if (core.getResult(i) != game.results[i]) {
+            cerr << "Peringatan: hasil tebakan " << i + 1 << " berbeda dari rekaman.\n";
+        }
+        draw(at);
+    }
+
+    if (game.finished) {
+        screen.beginFrame();
+        board.displayStats(core, game.won, game.timed ? static_cast<int64_t>(game.elapsedMs) : -1);
+        if (game.won) screen.addLine("Skor: " + to_string(game.score) + (game.playerName.empty() ? "" : " (" + game.playerName + ")"));
+        screen.present();
+    } else {
+        cout << "\nPemain keluar sebelum permainan selesai.\n";
+    }
+    return 0;
+}
+
+/*
+ * STATS: blok dibagi ke beberapa thread, masing-masing dengan penampung sendiri
+ */
+struct DifficultyStats {
+    uint64_t games = 0;
+    uint64_t wins = 0;
+    uint64_t quits = 0;
+    uint64_t winAttempts = 0;
+    uint64_t winMs = 0;
+};
+
+struct PlayerStats {
+    uint64_t wins = 0;
+    uint64_t totalScore = 0;
+    int bestScore = 0;
+    uint32_t fastestMs = 0; // Kemenangan speedrun tercepat, 0 jika belum ada
+};
+
+struct AnalyticsStats {
+    unordered_map<uint64_t, DifficultyStats> difficulties; // Kunci: digits << 32 | maxAttempts
+    unordered_map<string, PlayerStats> players;
+    uint64_t games = 0;
+    uint64_t guesses = 0;
+    uint64_t thinkMs = 0;
+    uint64_t badBlocks = 0;
+    int64_t firstStart = INT64_MAX;
+    int64_t lastStart = INT64_MIN;
+
+    void add(const GameRecord& game) {
+        games++;
+        firstStart = min(firstStart, game.startedAt);
+        lastStart = max(lastStart, game.startedAt);
+        DifficultyStats& difficulty =
+            difficulties[static_cast<uint64_t>(game.digits) << 32 | static_cast<uint32_t>(game.maxAttempts)];
+        difficulty.games++;
+        if (!game.finished) difficulty.quits++;
+        if (game.won) {
+            difficulty.wins++;
+            difficulty.winAttempts += static_cast<uint64_t>(game.attempts);
+            difficulty.winMs += game.elapsedMs;
+        }
+        if (!game.playerName.empty()) {
+            PlayerStats& player = players[game.playerName];
+            player.wins++;
+            player.totalScore += static_cast<uint64_t>(max(game.score, 0));
+            player.bestScore = max(player.bestScore, game.score);
+            if (game.timed && (player.fastestMs == 0 || game.elapsedMs < player.fastestMs)) player.fastestMs = game.elapsedMs;
+        }
+        if (!game.guessMs.empty()) {
+            guesses += game.guessMs.size();
+            thinkMs += game.guessMs.back();
+        }
+    }
+
+    void merge(const AnalyticsStats& other) {
+        games += other.games;
+        guesses += other.guesses;
+        thinkMs += other.thinkMs;
+        badBlocks += other.badBlocks;
+        firstStart = min(firstStart, other.firstStart);
+        lastStart = max(lastStart, other.lastStart);
+        for (const auto& [key, value] : other.difficulties) {
+            DifficultyStats& difficulty = difficulties[key];
+            difficulty.games += value.games;
+            difficulty.wins += value.wins;
+            difficulty.quits += value.quits;
+            difficulty.winAttempts += value.winAttempts;
+            difficulty.winMs += value.winMs;
+        }
+        for (const auto& [name, value] : other.players) {
+            PlayerStats& player = players[name];
+            player.wins += value.wins;
+            player.totalScore += value.totalScore;
+            player.bestScore = max(player.bestScore, value.bestScore);
+            if (value.fastestMs && (player.fastestMs == 0 || value.fastestMs < player.fastestMs)) player.fastestMs = value.fastestMs;
+        }
+    }
+};
+
+int runStats(const RecordingReader& reader, const Options& options) {
+    unsigned threads = options.threads ? options.threads : max(1u, thread::hardware_concurrency());
+    threads = static_cast<unsigned>(min<size_t>(threads, max<size_t>(reader.blockCount(), 1)));
+
+    vector<AnalyticsStats> locals(threads);
+    atomic<size_t> nextBlock{0};
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            vector<uint8_t> buffer;
+            vector<GameRecord> decoded;
+            AnalyticsStats& local = locals[t];
+            // Blok diambil satu per satu agar thread yang cepat tidak menganggur
+            for (size_t i; (i = nextBlock.fetch_add(1, memory_order_relaxed)) < reader.blockCount();) {
+                if (!reader.decodeBlock(i, buffer, decoded, options.full)) {
+                    local.badBlocks++;
+                    continue;
+                }
+                for (const GameRecord& game : decoded) local.add(game);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    AnalyticsStats stats;
+    for (const auto& local : locals) stats.merge(local);
+
+    cout << fixed << setprecision(1);
+    cout << stats.games << " permainan, " << reader.blockCount() << " blok (" << reader.getIndexedBlocks()
+         << " lewat indeks), " << reader.getFileSize() / (1024.0 * 1024.0) << " MiB dalam " << setprecision(3)
+         << seconds << " detik (" << setprecision(0) << reader.getFileSize() / (1024.0 * 1024.0) / max(seconds, 1e-9)
+         << " MiB/detik, " << stats.games / max(seconds, 1e-9) << " permainan/detik, " << threads << " thread)\n";
+    if (stats.badBlocks) cout << "Blok rusak dilewati: " << stats.badBlocks << "\n";
+    if (stats.games == 0) return 0;
+    cout << "Rentang: " << formatTime(stats.firstStart) << " - " << formatTime(stats.lastStart) << "\n";
+    if (options.full && stats.guesses) {
+        cout << setprecision(2) << "Rata-rata waktu berpikir: " << stats.thinkMs / 1000.0 / stats.guesses
+             << " detik per tebakan\n";
+    }
+
+    vector<pair<uint64_t, DifficultyStats>> difficulties(stats.difficulties.begin(), stats.difficulties.end());
+    sort(difficulties.begin(), difficulties.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    cout << "\nTingkat kesulitan:\n";
+    cout << setw(6) << "Digit" << "  " << setw(10) << "Main" << "  " << setw(7) << "Menang" << "  " << setw(7)
+         << "Keluar" << "  " << setw(10) << "Percobaan" << "  " << setw(8) << "Waktu" << "\n";
+    for (const auto& [key, difficulty] : difficulties) {
+        double games = static_cast<double>(difficulty.games);
+        double wins = static_cast<double>(max<uint64_t>(difficulty.wins, 1));
+        cout << setw(6) << (to_string(key >> 32) + "/" + to_string(key & 0xFFFFFFFFu)) << "  " << setw(10)
+             << difficulty.games << "  " << setprecision(1) << setw(6) << 100.0 * difficulty.wins / games << "%  "
+             << setw(6) << 100.0 * difficulty.quits / games << "%  " << setprecision(2) << setw(10)
+             << difficulty.winAttempts / wins << "  " << setprecision(1) << setw(7) << difficulty.winMs / wins / 1000.0
+             << "s\n";
+    }
+
+    vector<pair<string, PlayerStats>> players(stats.players.begin(), stats.players.end());
+    sort(players.begin(), players.end(), [](const auto& a, const auto& b) {
+        return a.second.bestScore != b.second.bestScore ? a.second.bestScore > b.second.bestScore : a.first < b.first;
+    });
+    if (players.size() > options.top) players.resize(options.top);
+    if (!players.empty()) {
+        cout << "\nPemain (" << stats.players.size() << " total, " << players.size() << " teratas menurut skor terbaik):\n";
+        cout << setw(16) << "Nama" << "  " << setw(8) << "Menang" << "  " << setw(8) << "Terbaik" << "  " << setw(10)
+             << "Rata-rata" << "  " << setw(9) << "Speedrun" << "\n";
+        for (const auto& [name, player] : players) {
+            cout << setw(16) << name << "  " << setw(8) << player.wins << "  " << setw(8) << player.bestScore << "  "
+                 << setw(10) << setprecision(1) << static_cast<double>(player.totalScore) / max<uint64_t>(player.wins, 1)
+                 << "  " << setw(8) << player.fastestMs / 1000.0 << "s\n";
+        }
+    }
+    return 0;
+}
+
+/*
+ * GENERATE: permainan strategi otomatis dengan waktu buatan, untuk menguji format dan analisis
+ */
+int runGenerate(const Options& options) {
+    unique_ptr<GuessStrategy> strategy = createStrategy(options.strategy);
+    if (!strategy || options.digits < 1 || options.digits > 9) {
+        cerr << "Strategi tidak dikenal atau jumlah digit bukan 1-9.\n";
+        return 1;
+    }
+    GameConfig config{options.digits, options.attempts};
+    Rng gen(options.seed);
+    GameCore core;
+    RecordingWriter writer(options.file);
+
+    auto start = chrono::steady_clock::now();
+    int64_t startedAt = recordingNowMs() - static_cast<int64_t>(options.games) * 60000;
+    for (uint64_t g = 0; g < options.games; g++) {
+        core.startNewGame(config.digits, config.maxAttempts, gen);
+        strategy->reset(config);
+        GameRecord record;
+        record.startedAt = startedAt += 30000 + static_cast<int64_t>(gen.below(60000));
+        uint32_t ms = 0;
+        while (!core.isOver()) {
+            core.submitGuess(strategy->nextGuess(core, gen));
+            record.guessMs.push_back(ms += 800 + static_cast<uint32_t>(gen.below(19201)));
+        }
+        fillGameRecord(record, core);
+        record.elapsedMs = ms;
+        record.timed = g % 5 == 0;
+        if (record.won) {
+            record.score = record.timed ? calculateTimedScore(config.maxAttempts, core.getCurrentAttempt(), config.digits, ms)
+                                        : core.calculateScore();
+            record.playerName = "pemain" + to_string(1 + gen.below(500));
+        }
+        writer.record(std::move(record));
+    }
+    writer.flush();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << writer.getGamesWritten() << " permainan ditulis ke " << options.file << " dalam " << fixed
+         << setprecision(2) << seconds << " detik (" << writer.getBlocksWritten() << " blok, "
+         << writer.getWriteErrors() << " galat)\n";
+    return writer.getWriteErrors() ? 1 : 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    options.command = argv[1];
+    int first = 2;
+    if (options.command == "show") {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        options.game = strtoull(argv[2], nullptr, 10);
+        first = 3;
+    }
+
+    for (int i = first; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--file") == 0 && hasValue) options.file = argv[++i];
+        else if (strcmp(arg, "--from") == 0 && hasValue) options.from = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--count") == 0 && hasValue) options.count = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--speed") == 0 && hasValue) options.speed = atof(argv[++i]);
+        else if (strcmp(arg, "--threads") == 0 && hasValue) options.threads = static_cast<unsigned>(atoi(argv[++i]));
+        else if (strcmp(arg, "--top") == 0 && hasValue) options.top = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--full") == 0) options.full = true;
+        else if (strcmp(arg, "--games") == 0 && hasValue) options.games = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--digits") == 0 && hasValue) options.digits = atoi(argv[++i]);
+        else if (strcmp(arg, "--attempts") == 0 && hasValue) options.attempts = atoi(argv[++i]);
+        else if (strcmp(arg, "--strategy") == 0 && hasValue) options.strategy = argv[++i];
+        else if (strcmp(arg, "--seed") == 0 && hasValue) options.seed = strtoull(argv[++i], nullptr, 10);
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (options.command == "generate") return runGenerate(options);
+
+    RecordingReader reader;
+    if (!reader.open(options.file)) {
+        cerr << "Tidak bisa membuka rekaman " << options.file << "\n";
+        return 1;
+    }
+    if (options.command == "list") return runList(reader, options);
+    if (options.command == "show") return runShow(reader, options);
+    if (options.command == "stats") return runStats(reader, options);
+    printUsage(argv[0]);
+    return 1;
+}
@@ -0,0 +1,212 @@
+#include "symbolic_screen.h"
+#include "symbolic_alloc.h"
+#include "symbolic_broadcast.h"
+#include "symbolic_trace.h"
+
+#include <charconv>
+#include <cstdio>
+#include <iostream>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+// Indeks warna sel (ScreenColor) -> kode ANSI
+const char* const COLOR_CODES[] = {"\033[0m", "\033[32m", "\033[33m", "\033[31m", "\033[36m", "\033[35m"};
+
+// Sel yang sama di antara dua perubahan tetap ditulis ulang jika celahnya
+// lebih pendek dari escape pindah kursor
+constexpr size_t MAX_REWRITE_GAP = 6;
+
+uint8_t colorIndex(int sgr) {
+    switch (sgr) {
+        case 32: return COLOR_GREEN;
+        case 33: return COLOR_YELLOW;
+        case 31: return COLOR_RED;
+        case 36: return COLOR_CYAN;
+        case 35: return COLOR_MAGENTA;
+        default: return COLOR_RESET;
+    }
+}
+
+void appendMove(string& out, size_t row, size_t col) {
+    // "\033[" + dua angka 64-bit (masing-masing paling banyak 20 digit) + ";H"
+    char text[48] = "\033[";
+    char* end = to_chars(text + 2, text + 22, row + 1).ptr;
+    *end++ = ';';
+    end = to_chars(end, text + sizeof text - 1, col + 1).ptr;
+    *end++ = 'H';
+    out.append(text, static_cast<size_t>(end - text));
+}
+
+} // namespace
+
+void writeTerminal(const string& data) {
+#ifdef _WIN32
+    fwrite(data.data(), 1, data.size(), stdout);
+    fflush(stdout);
+#else
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = write(STDOUT_FILENO, data.data() + written, data.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            perror("write()");
+            return;
+        }
+        written += static_cast<size_t>(n);
+    }
+#endif
+}
+
+/*
+ * SATU BARIS SEL
+ */
+ScreenLine& ScreenLine::appendPlain(string_view text) {
+    for (char ch : text) cells.push_back({ch, color});
+    return *this;
+}
+
+ScreenLine& ScreenLine::fill(char ch, size_t count) {
+    cells.insert(cells.end(), count, ScreenCell{ch, color});
+    return *this;
+}
+
+ScreenLine& ScreenLine::operator<<(string_view text) {
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\033' && i + 1 < text.size() && text[i + 1] == '[') {
+            // Escape SGR "\033[..m": parameter terakhir menentukan warna
+            int param = 0;
+            size_t j = i + 2;
+            for (; j < text.size() && text[j] != 'm'; j++) {
+                if (text[j] == ';') param = 0;
+                else if (text[j] >= '0' && text[j] <= '9') param = param * 10 + (text[j] - '0');
+            }
+            color = colorIndex(param);
+            i = j;
+            continue;
+        }
+        cells.push_back({text[i], color});
+    }
+    return *this;
+}
+
+ScreenLine& ScreenLine::operator<<(const ScreenLine& other) {
+    cells.insert(cells.end(), other.cells.begin(), other.cells.end());
+    return *this;
+}
+
+void ScreenLine::appendNumber(uint64_t value, bool negative) {
+    char text[24];
+    char* end = to_chars(text, text + sizeof text, value).ptr;
+    if (negative) cells.push_back({'-', color});
+    appendPlain(string_view(text, static_cast<size_t>(end - text)));
+}
+
+/*
+ * LAYAR
+ */
+void ScreenBuffer::beginFrame() {
+    backRows = 0;
+}
+
+ScreenLine& ScreenBuffer::newLine() {
+    if (backRows == back.size()) back.emplace_back();
+    return back[backRows++].clear();
+}
+
+const string& ScreenBuffer::composeFrame() {
+    SYMBOLIC_ALLOC_SCOPE(AllocPhase::RENDER);
+    static const ScreenLine emptyRow;
+    frame.clear();
+
+    // Baris terakhir terminal disisakan untuk kursor di bawah frame
+    size_t shownRows = (height > 1 && backRows > height - 1) ? height - 1 : backRows;
+    size_t firstRow = backRows - shownRows;
+
+    size_t knownRows = fullRedraw ? 0 : frontRows;
+    size_t cursorRow = SIZE_MAX, cursorCol = 0;
+    uint8_t color = 0;
+    if (fullRedraw) {
+        frame += "\033[2J\033[H";
+        cursorRow = 0;
+    }
+
+    for (size_t r = 0; r < shownRows; r++) {
+        const vector<ScreenCell>& next = back[firstRow + r].getCells();
+        const vector<ScreenCell>& prev = (r < knownRows ? front[frontFirst + r] : emptyRow).getCells();
+        auto same = [&](size_t c) { return c < prev.size() && prev[c] == next[c]; };
+
+        size_t col = 0;
+        while (col < next.size()) {
+            if (same(col)) {
+                col++;
+                continue;
+            }
+            // Gabungkan perubahan yang berdekatan menjadi satu tulisan
+            size_t runEnd = col + 1, gap = 0;
+            for (size_t c = col + 1; c < next.size() && gap <= MAX_REWRITE_GAP; c++) {
+                if (same(c)) {
+                    gap++;
+                } else {
+                    gap = 0;
+                    runEnd = c + 1;
+                }
+            }
+            if (cursorRow != r || cursorCol != col) appendMove(frame, r, col);
+            for (size_t c = col; c < runEnd; c++) {
+                if (next[c].color != color) {
+                    color = next[c].color;
+                    frame += COLOR_CODES[color];
+                }
+                frame += next[c].ch;
+            }
+            cursorRow = r;
+            cursorCol = runEnd;
+            col = runEnd;
+        }
+
+        // Sisa baris lama (atau teks lain di baris baru) dihapus
+        if (prev.size() > next.size() || (!fullRedraw && r >= knownRows)) {
+            if (cursorRow != r || cursorCol != next.size()) appendMove(frame, r, next.size());
+            if (color != 0) {
+                color = 0;
+                frame += COLOR_CODES[0];
+            }
+            frame += "\033[K";
+            cursorRow = r;
+            cursorCol = next.size();
+        }
+    }
+
+    // Kursor diletakkan di bawah frame dan semua yang tersisa di bawahnya dihapus
+    if (color != 0) frame += COLOR_CODES[0];
+    if (cursorRow != shownRows || cursorCol != 0) appendMove(frame, shownRows, 0);
+    frame += "\033[J";
+
+    // Penonton menerima frame utuh dan memotongnya sendiri menurut terminalnya
+    if (broadcast) broadcast->publish(*this);
+    swap(front, back);
+    frontRows = shownRows;
+    frontFirst = firstRow;
+    fullRedraw = false;
+
+    lastFrameBytes = frame.size();
+    totalBytes += frame.size();
+    frameCount++;
+    return frame;
+}
+
+size_t ScreenBuffer::present() {
+    const string& bytes = composeFrame();
+    SYMBOLIC_TRACE_SCOPE(TracePhase::FLUSH);
+    cout.flush();
+    fflush(stdout);
+    writeTerminal(bytes);
+    return lastFrameBytes;
+}
@@ -0,0 +1,163 @@
+/*
+ * SYMBOLIC NUMBLER - LAYAR GANDA (DOUBLE BUFFER) DENGAN DIFF
+ *
+ * Frame disusun baris per baris ke buffer belakang, lalu dibandingkan
+ * dengan frame sebelumnya. Hanya sel yang berubah yang dikirim ke
+ * terminal memakai escape posisi kursor, dalam satu kali write.
+ *
+ * Baris disusun per potongan langsung ke sel (ScreenLine): kode warna
+ * diurai sekali saat ditambahkan dan lebar visual adalah jumlah sel, jadi
+ * tidak ada string perantara dan tidak ada pemindaian ulang. Semua baris,
+ * sel dan buffer frame dipakai ulang, sehingga setelah beberapa frame
+ * pertama menggambar papan tidak mengalokasikan memori sama sekali
+ * (diperiksa oleh symbolic_bench --check-allocations).
+ *
+ * Setiap baris ditulis di posisi mutlak, jadi frame yang lebih tinggi dari
+ * terminal tidak bergulir: kursor tertahan di baris terakhir dan baris
+ * sisanya saling menimpa. Jika tinggi terminal diketahui (setHeight), hanya
+ * baris terbawah yang muat yang dikirim, seperti yang terlihat setelah
+ * output biasa bergulir; penyusun layar sebaiknya sudah meringkas isinya.
+ */
+#ifndef SYMBOLIC_SCREEN_H
+#define SYMBOLIC_SCREEN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Satu sel layar: karakter dan indeks warna ANSI
+struct ScreenCell {
+    char ch;
+    uint8_t color;
+
+    bool operator==(const ScreenCell& other) const { return ch == other.ch && color == other.color; }
+    bool operator!=(const ScreenCell& other) const { return !(*this == other); }
+};
+
+// Indeks warna sel (kode ANSI masing-masing ada di symbolic_screen.cpp)
+enum ScreenColor : uint8_t { COLOR_RESET, COLOR_GREEN, COLOR_YELLOW, COLOR_RED, COLOR_CYAN, COLOR_MAGENTA };
+
+// Menulis semua byte ke stdout dengan write(), tanpa menyentuh cout
+// (aman dipanggil dari thread render)
+void writeTerminal(const std::string& data);
+
+/*
+ * SATU BARIS SEL
+ * Potongan ditambahkan dengan <<; teks boleh berisi escape warna "\033[..m"
+ * yang mengganti warna potongan berikutnya, seperti saat dicetak ke terminal.
+ */
+class ScreenLine {
+private:
+    std::vector<ScreenCell> cells;
+    uint8_t color = COLOR_RESET;
+
+    void appendNumber(uint64_t value, bool negative);
+
+public:
+    // Kosongkan tanpa melepas kapasitas
+    ScreenLine& clear() {
+        cells.clear();
+        color = COLOR_RESET;
+        return *this;
+    }
+
+    ScreenLine& setColor(uint8_t newColor) {
+        color = newColor;
+        return *this;
+    }
+
+    // Teks tanpa escape (seni glif, angka) disalin langsung dengan warna saat ini
+    ScreenLine& appendPlain(std::string_view text);
+    ScreenLine& fill(char ch, size_t count);
+    // Sel siap pakai (misalnya frame siaran) beserta warnanya
+    ScreenLine& appendCells(const ScreenCell* source, size_t count) {
+        cells.insert(cells.end(), source, source + count);
+        return *this;
+    }
+
+    ScreenLine& operator<<(std::string_view text);
+    ScreenLine& operator<<(const char* text) { return *this << std::string_view(text); }
+    ScreenLine& operator<<(const std::string& text) { return *this << std::string_view(text); }
+    ScreenLine& operator<<(char ch) { return fill(ch, 1); }
+    ScreenLine& operator<<(const ScreenLine& other); // Warna setiap sel ikut disalin
+
+    template <typename Int, typename = std::enable_if_t<std::is_integral_v<Int> && !std::is_same_v<Int, char> &&
+                                                        !std::is_same_v<Int, bool>>>
+    ScreenLine& operator<<(Int value) {
+        if constexpr (std::is_signed_v<Int>) {
+            if (value < 0) {
+                appendNumber(0 - static_cast<uint64_t>(value), true);
+                return *this;
+            }
+        }
+        appendNumber(static_cast<uint64_t>(value), false);
+        return *this;
+    }
+
+    // Lebar visual tanpa kode warna
+    size_t width() const { return cells.size(); }
+    const std::vector<ScreenCell>& getCells() const { return cells; }
+};
+
+class BroadcastPublisher;
+
+class ScreenBuffer {
+private:
+    std::vector<ScreenLine> front;
+    std::vector<ScreenLine> back;
+    size_t frontRows = 0;  // Baris yang tampil di terminal dari frame sebelumnya
+    size_t frontFirst = 0; // ...mulai dari baris ini (baris di atasnya tidak muat)
+    size_t backRows = 0;
+    size_t height = 0;     // Tinggi terminal, 0 jika tidak diketahui
+    bool fullRedraw = true;
+
+    std::string frame;
+    size_t lastFrameBytes = 0;
+    uint64_t totalBytes = 0;
+    uint64_t frameCount = 0;
+    BroadcastPublisher* broadcast = nullptr;
+
+    void emitRow(size_t row);
+
+public:
+    // Memulai frame baru yang kosong
+    void beginFrame();
+
+    // Baris berikutnya yang masih kosong, untuk disusun langsung per potongan
+    ScreenLine& newLine();
+
+    // Menambahkan satu baris teks (boleh berisi kode warna ANSI)
+    void addLine(std::string_view text) { newLine() << text; }
+
+    // Frame berikutnya digambar ulang penuh (layar diubah oleh output lain)
+    void invalidate() { fullRedraw = true; }
+
+    // Tinggi terminal dalam baris (0 = tidak diketahui, frame tidak dipotong);
+    // perubahan membuat frame berikutnya digambar ulang penuh
+    void setHeight(size_t rows) {
+        if (rows != height) fullRedraw = true;
+        height = rows;
+    }
+    size_t getHeight() const { return height; }
+
+    // Setiap frame yang disusun juga dikirim ke penonton (nullptr = tidak disiarkan)
+    void setBroadcast(BroadcastPublisher* publisher) { broadcast = publisher; }
+
+    // Menyusun byte perbedaan frame tanpa menulisnya
+    const std::string& composeFrame();
+
+    // Menyusun lalu menulis frame ke stdout dalam satu write; mengembalikan jumlah byte
+    size_t present();
+
+    size_t getRowCount() const { return backRows; }
+    // Baris frame yang sedang disusun (row < getRowCount())
+    const ScreenLine& getLine(size_t row) const { return back[row]; }
+    size_t getLastFrameBytes() const { return lastFrameBytes; }
+    uint64_t getTotalBytes() const { return totalBytes; }
+    uint64_t getFrameCount() const { return frameCount; }
+};
+
+#endif
@@ -0,0 +1,386 @@
+#include "symbolic_server.h"
+#include "symbolic_leaderboard.h"
+#include "symbolic_recording.h"
+#include "symbolic_session.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace {
+
+constexpr int EPOLL_BATCH = 256;
+constexpr int EPOLL_TIMEOUT_MS = 100; // Seberapa cepat reactor melihat permintaan berhenti
+constexpr int ACCEPT_BATCH = 64;
+constexpr size_t READ_CHUNK = 4096;
+
+// PERINTAH TELNET (RFC 854, 857, 858, 1073)
+constexpr unsigned char IAC = 255, DONT = 254, DO = 253, WONT = 252, WILL = 251, SB = 250, SE = 240;
+constexpr unsigned char OPT_ECHO = 1, OPT_SGA = 3, OPT_NAWS = 31;
+
+// Server menggema sendiri dan meminta mode karakter serta ukuran jendela
+constexpr unsigned char TELNET_HELLO[] = {IAC, WILL, OPT_ECHO, IAC, WILL, OPT_SGA, IAC, DO, OPT_NAWS};
+
+// Memisahkan perintah telnet dari tombol yang diketik
+class TelnetDecoder {
+private:
+    enum Mode { DATA, COMMAND, OPTION, SUBNEGOTIATION, SUBNEGOTIATION_IAC };
+    Mode mode = DATA;
+    unsigned char sub[8];
+    size_t subLength = 0;
+
+public:
+    // Tombol ditambahkan ke keys; columns dan rows diisi jika klien mengirim NAWS
+    void decode(const char* data, size_t size, string& keys, int& columns, int& rows) {
+        for (size_t i = 0; i < size; i++) {
+            unsigned char byte = static_cast<unsigned char>(data[i]);
+            switch (mode) {
+                case DATA:
+                    if (byte == IAC) mode = COMMAND;
+                    else keys += static_cast<char>(byte);
+                    break;
+                case COMMAND:
+                    if (byte == IAC) {
+                        keys += static_cast<char>(byte);
+                        mode = DATA;
+                    } else if (byte >= WILL && byte <= DONT) {
+                        mode = OPTION;
+                    } else if (byte == SB) {
+                        subLength = 0;
+                        mode = SUBNEGOTIATION;
+                    } else {
+                        mode = DATA; // NOP, GA, dll.
+                    }
+                    break;
+                case OPTION:
+                    mode = DATA; // Jawaban klien atas tawaran kita diterima apa adanya
+                    break;
+                case SUBNEGOTIATION:
+                    if (byte == IAC) mode = SUBNEGOTIATION_IAC;
+                    else if (subLength < sizeof sub) sub[subLength++] = byte;
+                    break;
+                case SUBNEGOTIATION_IAC:
+                    if (byte == SE) {
+                        if (subLength >= 5 && sub[0] == OPT_NAWS) {
+                            columns = (sub[1] << 8) | sub[2];
+                            rows = (sub[3] << 8) | sub[4];
+                        }
+                        mode = DATA;
+                    } else {
+                        if (subLength < sizeof sub) sub[subLength++] = byte; // IAC IAC di dalam SB
+                        mode = SUBNEGOTIATION;
+                    }
+                    break;
+            }
+        }
+    }
+};
+
+// Soket yang terdaftar di epoll: pendengar atau koneksi
+struct Endpoint {
+    int fd;
+    bool listener;
+    bool tcp;
+    bool telnet;
+};
+
+struct Connection : Endpoint {
+    GameSession session;
+    TelnetDecoder decoder;
+    size_t written = 0;   // Bagian pendingOutput() yang sudah terkirim
+    bool waitingWritable = false;
+
+    Connection(const Endpoint& listener, int socket, Rng& rng, LeaderboardStore& leaderboard,
+               RecordingWriter* recorder)
+        : Endpoint{socket, false, listener.tcp, listener.telnet}, session(rng, leaderboard, recorder) {}
+};
+
+class Reactor {
+private:
+    const ServerOptions& options;
+    int epollFd = -1;
+    Rng rng; // Aliran sendiri per reactor dari satu benih induk
+    LeaderboardStore leaderboard;
+    RecordingWriter* recorder; // Dipakai bersama semua reactor; record() aman dari banyak thread
+    unordered_map<int, unique_ptr<Connection>> connections;
+    string keys;
+
+    bool watch(int op, Endpoint* endpoint, uint32_t events) {
+        epoll_event event = {};
+        event.events = events;
+        event.data.ptr = endpoint;
+        return epoll_ctl(epollFd, op, endpoint->fd, &event) == 0;
+    }
+
+    void closeConnection(Connection* connection) {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, connection->fd, nullptr);
+        ::close(connection->fd);
+        stats.closed++;
+        connections.erase(connection->fd);
+    }
+
+    // Mengirim sebanyak mungkin; false jika koneksi sudah ditutup
+    bool flush(Connection* connection) {
+        string& output = connection->session.pendingOutput();
+        while (connection->written < output.size()) {
+            ssize_t n = send(connection->fd, output.data() + connection->written, output.size() - connection->written,
+                             MSG_NOSIGNAL);
+            if (n > 0) {
+                connection->written += static_cast<size_t>(n);
+                stats.bytesSent += static_cast<uint64_t>(n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                if (output.size() - connection->written > options.maxPendingBytes) {
+                    stats.slowClients++;
+                    closeConnection(connection);
+                    return false;
+                }
+                if (!connection->waitingWritable) {
+                    connection->waitingWritable = true;
+                    watch(EPOLL_CTL_MOD, connection, EPOLLIN | EPOLLOUT | EPOLLRDHUP);
+                }
+                return true;
+            }
+            closeConnection(connection);
+            return false;
+        }
+
+        output.clear();
+        connection->written = 0;
+        if (connection->waitingWritable) {
+            connection->waitingWritable = false;
+            watch(EPOLL_CTL_MOD, connection, EPOLLIN | EPOLLRDHUP);
+        }
+        if (connection->session.isClosed()) {
+            closeConnection(connection); // Frame perpisahan sudah terkirim
+            return false;
+        }
+        return true;
+    }
+
+    void acceptConnections(const Endpoint* listener) {
+        for (int i = 0; i < ACCEPT_BATCH; i++) {
+            int fd = accept4(listener->fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) {
+                if (errno == EINTR) continue;
+                return; // EAGAIN: reactor lain atau antrean kosong
+            }
+            if (listener->tcp) {
+                int one = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof one);
+            }
+
+            auto connection = make_unique<Connection>(*listener, fd, rng, leaderboard, recorder);
+            Connection* raw = connection.get();
+            if (!watch(EPOLL_CTL_ADD, raw, EPOLLIN | EPOLLRDHUP)) {
+                ::close(fd);
+                continue;
+            }
+            connections.emplace(fd, move(connection));
+            stats.accepted++;
+
+            string& output = raw->session.pendingOutput();
+            if (raw->telnet) output.assign(reinterpret_cast<const char*>(TELNET_HELLO), sizeof TELNET_HELLO);
+            raw->session.start();
+            stats.frames++;
+            flush(raw);
+        }
+    }
+
+    void readConnection(Connection* connection) {
+        char buffer[READ_CHUNK];
+        ssize_t n = read(connection->fd, buffer, sizeof buffer);
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return;
+        if (n <= 0) {
+            closeConnection(connection);
+            return;
+        }
+        stats.bytesReceived += static_cast<uint64_t>(n);
+
+        keys.clear();
+        if (connection->telnet) {
+            int columns = -1, rows = -1;
+            connection->decoder.decode(buffer, static_cast<size_t>(n), keys, columns, rows);
+            if (columns >= 0) connection->session.resize(columns, rows);
+        } else {
+            keys.assign(buffer, static_cast<size_t>(n));
+        }
+        if (keys.empty()) {
+            // Hanya negosiasi telnet; tinggi baru menyusun ulang frame
+            if (!connection->session.pendingOutput().empty()) {
+                stats.frames++;
+                flush(connection);
+            }
+            return;
+        }
+
+        // Semua tombol dalam satu bacaan menghasilkan satu frame
+        connection->session.handleInput(keys.data(), keys.size());
+        stats.frames++;
+        flush(connection);
+    }
+
+public:
+    ServerStats stats;
+
+    Reactor(const ServerOptions& serverOptions, RecordingWriter* gameRecorder, const Rng& stream)
+        : options(serverOptions), rng(stream), leaderboard(serverOptions.leaderboardPath), recorder(gameRecorder) {}
+
+    ~Reactor() {
+        for (auto& entry : connections) ::close(entry.first);
+        if (epollFd >= 0) ::close(epollFd);
+    }
+
+    bool open(vector<Endpoint>& listeners) {
+        epollFd = epoll_create1(EPOLL_CLOEXEC);
+        if (epollFd < 0) return false;
+        leaderboard.load(""); // Impor teks lama sudah dilakukan sebelum reactor dimulai
+        for (auto& listener : listeners) {
+            if (!watch(EPOLL_CTL_ADD, &listener, EPOLLIN | EPOLLEXCLUSIVE)) return false;
+        }
+        return true;
+    }
+
+    void run(const atomic<bool>& stop) {
+        epoll_event events[EPOLL_BATCH];
+        while (!stop.load(memory_order_relaxed)) {
+            int count = epoll_wait(epollFd, events, EPOLL_BATCH, EPOLL_TIMEOUT_MS);
+            if (count < 0) {
+                if (errno == EINTR) continue;
+                perror("epoll_wait()");
+                return;
+            }
+            for (int i = 0; i < count; i++) {
+                Endpoint* endpoint = static_cast<Endpoint*>(events[i].data.ptr);
+                if (endpoint->listener) {
+                    acceptConnections(endpoint);
+                    continue;
+                }
+                Connection* connection = static_cast<Connection*>(endpoint);
+                uint32_t flags = events[i].events;
+                if (flags & (EPOLLERR | EPOLLHUP)) {
+                    closeConnection(connection);
+                    continue;
+                }
+                if ((flags & EPOLLOUT) && !flush(connection)) continue;
+                if (flags & (EPOLLIN | EPOLLRDHUP)) readConnection(connection);
+            }
+        }
+    }
+};
+
+int openTcpListener(const ServerOptions& options) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof one);
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(options.port));
+    if (inet_pton(AF_INET, options.host.c_str(), &address.sin_addr) != 1 ||
+        bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof address) < 0 || listen(fd, SOMAXCONN) < 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int openUnixListener(const string& path) {
+    sockaddr_un address = {};
+    if (path.size() >= sizeof address.sun_path) return -1;
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    unlink(path.c_str()); // Sisa soket dari server sebelumnya
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof address) < 0 || listen(fd, SOMAXCONN) < 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+} // namespace
+
+bool runServer(const ServerOptions& options, const atomic<bool>& stop, ServerStats& stats) {
+    vector<Endpoint> listeners;
+    if (options.port != 0) {
+        int fd = openTcpListener(options);
+        if (fd < 0) {
+            perror("TCP");
+            return false;
+        }
+        listeners.push_back({fd, true, true, options.telnet});
+    }
+    if (!options.unixPath.empty()) {
+        int fd = openUnixListener(options.unixPath);
+        if (fd < 0) {
+            perror("unix");
+            for (auto& listener : listeners) ::close(listener.fd);
+            return false;
+        }
+        listeners.push_back({fd, true, false, false});
+    }
+    if (listeners.empty()) return false;
+
+    // Migrasi papan peringkat teks lama cukup sekali, sebelum reactor berjalan
+    {
+        LeaderboardStore store(options.leaderboardPath);
+        store.load();
+    }
+
+    // Satu penulis rekaman untuk semua reactor; dihancurkan setelah reactor sehingga
+    // permainan dari koneksi yang ditutup saat server berhenti ikut tertulis
+    unique_ptr<RecordingWriter> recorder;
+    if (!options.recordingPath.empty()) recorder = make_unique<RecordingWriter>(options.recordingPath);
+
+    // SYMBOLIC_SEED=N membuat urutan target setiap reactor bisa diulang
+    Rng master = Rng::fromEnvironment();
+    unsigned threads = options.threads ? options.threads : max(1u, thread::hardware_concurrency());
+    vector<unique_ptr<Reactor>> reactors;
+    bool ok = true;
+    for (unsigned t = 0; t < threads && ok; t++) {
+        reactors.push_back(make_unique<Reactor>(options, recorder.get(), master.split()));
+        ok = reactors.back()->open(listeners);
+    }
+
+    if (ok) {
+        vector<thread> workers;
+        for (auto& reactor : reactors) workers.emplace_back(&Reactor::run, reactor.get(), cref(stop));
+        for (auto& worker : workers) worker.join();
+    }
+
+    stats = ServerStats();
+    for (const auto& reactor : reactors) {
+        stats.accepted += reactor->stats.accepted;
+        stats.closed += reactor->stats.closed;
+        stats.frames += reactor->stats.frames;
+        stats.bytesReceived += reactor->stats.bytesReceived;
+        stats.bytesSent += reactor->stats.bytesSent;
+        stats.slowClients += reactor->stats.slowClients;
+    }
+    reactors.clear();
+
+    for (auto& listener : listeners) ::close(listener.fd);
+    if (!options.unixPath.empty()) unlink(options.unixPath.c_str());
+    return ok;
+}
@@ -0,0 +1,43 @@
+/*
+ * SYMBOLIC NUMBLER - SERVER MULTI-SESI (EPOLL, LINUX)
+ *
+ * Satu reactor epoll per inti CPU. Semua reactor mendengarkan soket yang
+ * sama (EPOLLEXCLUSIVE) sehingga koneksi baru tersebar tanpa thread
+ * penerima terpisah. Setiap koneksi memiliki GameSession sendiri dan tidak
+ * pernah berpindah reactor; tidak ada kunci di jalur tombol-ke-frame.
+ *
+ * TCP berbicara telnet (mode karakter, server yang menggema, NAWS untuk
+ * lebar layar); soket Unix mengirim byte mentah.
+ */
+#ifndef SYMBOLIC_SERVER_H
+#define SYMBOLIC_SERVER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct ServerOptions {
+    std::string host = "127.0.0.1";
+    int port = 4000;                  // 0 = tanpa TCP
+    std::string unixPath;             // Kosong = tanpa soket Unix
+    bool telnet = true;               // Negosiasi telnet di TCP
+    unsigned threads = 0;             // 0 = semua inti
+    std::string leaderboardPath = "symbolic_leaderboard.bin";
+    std::string recordingPath = "symbolic_games.rec"; // Kosong = tanpa rekaman permainan
+    size_t maxPendingBytes = 1 << 20; // Klien yang tidak membaca diputus
+};
+
+struct ServerStats {
+    uint64_t accepted = 0;
+    uint64_t closed = 0;
+    uint64_t frames = 0;
+    uint64_t bytesReceived = 0;
+    uint64_t bytesSent = 0;
+    uint64_t slowClients = 0;
+};
+
+// Berjalan sampai stop bernilai true; false jika soket tidak bisa dibuka
+bool runServer(const ServerOptions& options, const std::atomic<bool>& stop, ServerStats& stats);
+
+#endif
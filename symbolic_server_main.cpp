@@ -0,0 +1,120 @@
+/*
+ * SYMBOLIC NUMBLER - PROGRAM SERVER
+ *
+ * Contoh:
+ *   symbolic_server --port 4000            # lalu: telnet 127.0.0.1 4000
+ *   symbolic_server --port 0 --unix /tmp/symbolic.sock --threads 4
+ *   SYMBOLIC_TRACE=server_trace.json symbolic_server   # latensi per fase
+ */
+#include "symbolic_calibration.h"
+#include "symbolic_server.h"
+#include "symbolic_trace.h"
+
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <sys/resource.h>
+
+using namespace std;
+
+namespace {
+
+atomic<bool> stopRequested{false};
+
+void requestStop(int) { stopRequested.store(true); }
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " [opsi]\n"
+         << "  --host A          Alamat TCP (bawaan: 127.0.0.1)\n"
+         << "  --port N          Port TCP, 0 = tanpa TCP (bawaan: 4000)\n"
+         << "  --unix PATH       Juga mendengarkan di soket Unix\n"
+         << "  --no-telnet       TCP tanpa negosiasi telnet\n"
+         << "  --threads N       Jumlah reactor (bawaan: semua inti)\n"
+         << "  --leaderboard F   File papan peringkat (bawaan: symbolic_leaderboard.bin)\n"
+         << "  --record F        File rekaman permainan (bawaan: symbolic_games.rec)\n"
+         << "  --no-record       Tanpa rekaman permainan\n"
+         << "  --difficulty F    Tabel pengali skor (bawaan: symbolic_difficulty.txt jika ada)\n";
+}
+
+// Ribuan koneksi butuh lebih dari batas deskriptor bawaan (sering 1024)
+void raiseFileLimit() {
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    ServerOptions options;
+    string difficultyPath = "symbolic_difficulty.txt";
+    bool difficultyRequired = false;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--host") == 0 && hasValue) options.host = argv[++i];
+        else if (strcmp(arg, "--port") == 0 && hasValue) options.port = atoi(argv[++i]);
+        else if (strcmp(arg, "--unix") == 0 && hasValue) options.unixPath = argv[++i];
+        else if (strcmp(arg, "--no-telnet") == 0) options.telnet = false;
+        else if (strcmp(arg, "--threads") == 0 && hasValue) options.threads = static_cast<unsigned>(atoi(argv[++i]));
+        else if (strcmp(arg, "--leaderboard") == 0 && hasValue) options.leaderboardPath = argv[++i];
+        else if (strcmp(arg, "--record") == 0 && hasValue) options.recordingPath = argv[++i];
+        else if (strcmp(arg, "--no-record") == 0) options.recordingPath.clear();
+        else if (strcmp(arg, "--difficulty") == 0 && hasValue) {
+            difficultyPath = argv[++i];
+            difficultyRequired = true;
+        }
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Dimuat sebelum reactor berjalan; tabel hanya dibaca setelah ini
+    bool difficultyLoaded = loadDifficultyTable(difficultyPath);
+    if (!difficultyLoaded && difficultyRequired) {
+        cerr << "Tabel pengali tidak bisa dibaca: " << difficultyPath << "\n";
+        return 1;
+    }
+
+    raiseFileLimit();
+    string tracePath = traceStartFromEnv();
+    signal(SIGINT, requestStop);
+    signal(SIGTERM, requestStop);
+    signal(SIGPIPE, SIG_IGN);
+
+    if (options.port != 0) cout << "TCP       : " << options.host << ":" << options.port << "\n";
+    if (!options.unixPath.empty()) cout << "Soket Unix: " << options.unixPath << "\n";
+    if (difficultyLoaded) cout << "Pengali   : " << difficultyPath << "\n";
+    cout << "Tekan Ctrl+C untuk berhenti.\n" << flush;
+
+    ServerStats stats;
+    if (!runServer(options, stopRequested, stats)) {
+        cerr << "Server tidak bisa dijalankan.\n";
+        return 1;
+    }
+
+    cout << "\nKoneksi diterima : " << stats.accepted << " (ditutup " << stats.closed << ", lambat "
+         << stats.slowClients << ")\n"
+         << "Frame dikirim    : " << stats.frames << "\n"
+         << "Byte masuk/keluar: " << stats.bytesReceived << " / " << stats.bytesSent << "\n";
+
+    // Histogram semua reactor digabung; trace Chrome ditulis oleh atexit
+    if (!tracePath.empty()) {
+        for (int i = 0; i < TRACE_PHASE_COUNT; i++) {
+            TracePhase phase = static_cast<TracePhase>(i);
+            TraceSummary summary = traceSummary(phase);
+            if (summary.count == 0) continue;
+            cout << "Latensi " << tracePhaseName(phase) << ": n=" << summary.count << " p50=" << summary.p50
+                 << " ns p99=" << summary.p99 << " ns maks=" << summary.max << " ns\n";
+        }
+        cout << "Trace Chrome     : " << tracePath << "\n";
+    }
+    return 0;
+}
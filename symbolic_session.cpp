@@ -0,0 +1,312 @@
+#include "symbolic_session.h"
+
+#include <cctype>
+#include <cstdlib>
+
+using namespace std;
+
+namespace {
+
+constexpr const char* PAUSE_PROMPT = "Tekan tombol apa saja untuk melanjutkan...";
+constexpr const char* MENU_PROMPT = "Pilihan (1-9, D): ";
+constexpr const char* LEADERBOARD_PROMPT = "Tekan 1-9 untuk peringkat per digit, 0 untuk semua, tombol lain untuk melanjutkan...";
+
+bool isReturn(char ch) { return ch == '\r' || ch == '\n'; }
+
+} // namespace
+
+GameSession::GameSession(Rng& generator, LeaderboardStore& store, RecordingWriter* gameRecorder)
+    : rng(generator), leaderboard(store), recorder(gameRecorder) {}
+
+GameSession::~GameSession() {
+    if (unrecorded) recordGame("");
+}
+
+void GameSession::start() {
+    screen.invalidate();
+    render();
+}
+
+void GameSession::resize(int newColumns, int newRows) {
+    columns = newColumns;
+    if (newRows == rows) return;
+    rows = newRows;
+    screen.setHeight(static_cast<size_t>(rows));
+    render();
+}
+
+int64_t GameSession::elapsedMs(Clock::time_point at) const {
+    return chrono::duration_cast<chrono::milliseconds>(at - startedAt).count();
+}
+
+void GameSession::startGame(int digits, int attempts, bool timedMode, const string& fixedTarget) {
+    if (fixedTarget.empty()) core.startNewGame(digits, attempts, rng);
+    else core.startNewGame(digits, attempts, fixedTarget);
+    candidates.reset(digits);
+    candidateText.clear();
+    timed = timedMode;
+    finishedMs = -1;
+    board.configure(digits, columns);
+    input.clear();
+    state = State::INSTRUCTIONS;
+}
+
+void GameSession::recordGame(const string& name) {
+    unrecorded = false;
+    if (!recorder) return;
+    GameRecord record;
+    fillGameRecord(record, core);
+    record.timed = timed;
+    record.startedAt = gameStartedAt;
+    record.elapsedMs = guessMs.empty() ? 0 : guessMs.back();
+    record.score = core.isWon() ? score() : 0;
+    record.playerName = name;
+    record.guessMs = guessMs;
+    recorder->record(std::move(record));
+}
+
+int GameSession::score() const {
+    if (!timed) return core.calculateScore();
+    return calculateTimedScore(core.getMaxAttempts(), core.getCurrentAttempt(), core.getDigits(), finishedMs);
+}
+
+void GameSession::handleInput(const char* data, size_t size) {
+    inputAt = Clock::now();
+    bool afterPrintable = false;
+    for (size_t i = 0; i < size && state != State::CLOSED; i++) {
+        char ch = data[i];
+
+        // CR LF / CR NUL dari telnet dihitung satu Enter
+        if ((ch == '\n' || ch == '\0') && lastWasReturn) {
+            lastWasReturn = false;
+            continue;
+        }
+        lastWasReturn = ch == '\r';
+
+        // Klien mode baris mengirim "1\n": Enter setelah tombol di potongan yang
+        // sama bukan tombol kedua, kecuali di layar yang memang membaca baris
+        bool lineState = state == State::GUESSING || state == State::CUSTOM_DIGITS ||
+                         state == State::CUSTOM_ATTEMPTS || state == State::NAME_ENTRY;
+        if (isReturn(ch) && afterPrintable && !lineState) continue;
+        afterPrintable = isprint(static_cast<unsigned char>(ch)) != 0;
+
+        handleKey(ch);
+    }
+    render();
+}
+
+void GameSession::handleLineKey(char ch, bool digitsOnly, size_t maxLength) {
+    if (isReturn(ch)) {
+        submitLine();
+    } else if (ch == 8 || ch == 127) {
+        if (!input.empty()) input.pop_back();
+    } else if (digitsOnly ? isdigit(static_cast<unsigned char>(ch)) : isgraph(static_cast<unsigned char>(ch))) {
+        if (input.size() < maxLength) input += ch;
+    }
+}
+
+string GameSession::customPrompt(bool digitsStep) const {
+    if (digitsStep) {
+        return marathon ? "Masukkan jumlah digit (" + to_string(MARATHON_MIN_DIGITS) + "-" + to_string(MARATHON_MAX_DIGITS) + "): "
+                        : "Masukkan jumlah digit (3-6): ";
+    }
+    return marathon ? "Masukkan jumlah percobaan (4-" + to_string(MARATHON_MAX_ATTEMPTS) + "): "
+                    : "Masukkan jumlah percobaan (4-10): ";
+}
+
+void GameSession::submitLine() {
+    switch (state) {
+        case State::CUSTOM_DIGITS:
+        case State::CUSTOM_ATTEMPTS: {
+            bool digitsStep = state == State::CUSTOM_DIGITS;
+            int min = digitsStep ? (marathon ? MARATHON_MIN_DIGITS : CUSTOM_MIN_DIGITS) : 4;
+            int max = digitsStep ? (marathon ? MARATHON_MAX_DIGITS : CUSTOM_MAX_DIGITS)
+                                 : (marathon ? MARATHON_MAX_ATTEMPTS : 10);
+            int value = input.empty() ? 0 : atoi(input.c_str());
+            input.clear();
+            if (value < min || value > max) {
+                message = "Input tidak valid. Masukkan angka antara " + to_string(min) + " dan " + to_string(max) + ".";
+                return;
+            }
+            message.clear();
+            if (digitsStep) {
+                customDigits = value;
+                state = State::CUSTOM_ATTEMPTS;
+            } else {
+                startGame(customDigits, value);
+            }
+            break;
+        }
+        case State::GUESSING:
+            if (input.size() != static_cast<size_t>(core.getDigits())) {
+                message = "Butuh tepat " + to_string(core.getDigits()) + " digit!";
+                state = State::NOTICE;
+                return;
+            }
+            core.submitGuess(input);
+            candidates.sync(core);
+            candidateText.clear();
+            input.clear();
+            guessMs.push_back(static_cast<uint32_t>(elapsedMs(inputAt)));
+            if (timed && core.isOver()) finishedMs = elapsedMs(inputAt);
+            if (core.isWon()) {
+                state = State::NAME_ENTRY; // Direkam setelah nama dimasukkan
+            } else if (core.isOver()) {
+                recordGame("");
+                state = State::PLAY_AGAIN;
+            }
+            break;
+        case State::NAME_ENTRY:
+            if (input.empty()) return;
+            // Semua skor disimpan; tampilan hanya memuat sepuluh teratas
+            leaderboard.add({input, score(), core.getDigits(), core.getCurrentAttempt(), 0,
+                             timed ? static_cast<uint32_t>(finishedMs) : 0});
+            recordGame(input);
+            leaderboardKey = {core.getDigits(), 0};
+            leaderboardQuery = {input, score(), core.getDigits(), core.getCurrentAttempt()};
+            input.clear();
+            afterLeaderboard = State::PLAY_AGAIN;
+            state = State::LEADERBOARD;
+            break;
+        default:
+            break;
+    }
+}
+
+void GameSession::handleKey(char ch) {
+    switch (state) {
+        case State::MENU:
+            message.clear();
+            switch (ch) {
+                case '1': startGame(3, 6); break;
+                case '2': startGame(4, 6); break;
+                case '3': startGame(5, 6); break;
+                case '4': startGame(6, 8); break;
+                case '5':
+                case '8':
+                    input.clear();
+                    marathon = ch == '8';
+                    state = State::CUSTOM_DIGITS;
+                    break;
+                case '6':
+                    leaderboard.refresh(); // Skor dari sesi dan proses lain
+                    leaderboardKey = {};
+                    leaderboardQuery = {};
+                    afterLeaderboard = State::MENU;
+                    state = State::LEADERBOARD;
+                    break;
+                case '7': startGame(4, 6, true); break;
+                case 'd':
+                case 'D': {
+                    DailyChallenge daily = todaysChallenge();
+                    startGame(daily.digits, daily.maxAttempts, false, challengeTarget(daily));
+                    message = "Tantangan harian " + daily.date + ": target sama untuk semua pemain hari ini.";
+                    break;
+                }
+                case '9':
+                case 'q':
+                case 'Q':
+                    state = State::CLOSED;
+                    break;
+                default:
+                    if (!isprint(static_cast<unsigned char>(ch))) break;
+                    message = "Pilihan tidak valid. Memulai tingkat kesulitan sedang...";
+                    startGame(4, 6);
+                    break;
+            }
+            break;
+        case State::CUSTOM_DIGITS:
+        case State::CUSTOM_ATTEMPTS:
+            handleLineKey(ch, true);
+            break;
+        case State::INSTRUCTIONS:
+            message.clear();
+            startedAt = inputAt;
+            gameStartedAt = recordingNowMs();
+            guessMs.clear();
+            unrecorded = true;
+            state = State::GUESSING;
+            break;
+        case State::GUESSING:
+            if (tolower(static_cast<unsigned char>(ch)) == 'q') {
+                recordGame("");
+                state = State::PLAY_AGAIN;
+            } else if (tolower(static_cast<unsigned char>(ch)) == 'k' && candidates.isActive()) {
+                candidateText = describeCandidates(candidates, rng, CANDIDATES_SHOWN);
+            } else if (!isdigit(static_cast<unsigned char>(ch)) || input.size() < static_cast<size_t>(core.getDigits())) {
+                handleLineKey(ch, true, static_cast<size_t>(core.getDigits()));
+            }
+            break;
+        case State::NOTICE:
+            message.clear();
+            state = State::GUESSING;
+            break;
+        case State::NAME_ENTRY:
+            handleLineKey(ch, false);
+            break;
+        case State::LEADERBOARD:
+            if (isdigit(static_cast<unsigned char>(ch))) leaderboardKey = {ch - '0', 0};
+            else state = afterLeaderboard;
+            break;
+        case State::PLAY_AGAIN:
+            state = (tolower(static_cast<unsigned char>(ch)) == 'y') ? State::MENU : State::CLOSED;
+            break;
+        case State::CLOSED:
+            break;
+    }
+}
+
+void GameSession::render() {
+    screen.beginFrame();
+    switch (state) {
+        case State::MENU:
+            board.displayMenu();
+            screen.addLine(MENU_PROMPT);
+            break;
+        case State::CUSTOM_DIGITS:
+        case State::CUSTOM_ATTEMPTS:
+            board.displayMenu();
+            screen.addLine(string(MENU_PROMPT) + (marathon ? "8" : "5"));
+            if (state == State::CUSTOM_ATTEMPTS) screen.addLine(customPrompt(true) + to_string(customDigits));
+            if (!message.empty()) screen.addLine(message);
+            screen.addLine(customPrompt(state == State::CUSTOM_DIGITS) + input);
+            break;
+        case State::INSTRUCTIONS:
+            if (!message.empty()) screen.addLine(message);
+            board.displayInstructions(core, false, timed);
+            screen.addLine("");
+            screen.addLine(PAUSE_PROMPT);
+            break;
+        case State::GUESSING:
+            board.displayBoard(core, timed ? elapsedMs(Clock::now()) : -1,
+                               candidates.isActive() ? static_cast<int64_t>(candidates.count()) : -1);
+            board.displayGuessInput(input, candidateText, false, candidates.isActive());
+            break;
+        case State::NOTICE:
+            board.displayNotice(message);
+            screen.addLine("");
+            screen.addLine(PAUSE_PROMPT);
+            break;
+        case State::NAME_ENTRY:
+            board.displayStats(core, true, finishedMs);
+            screen.addLine("");
+            screen.addLine("Skor Anda: " + to_string(score()) + ". Masukkan nama (tanpa spasi): " + input);
+            break;
+        case State::LEADERBOARD:
+            board.displayLeaderboard(leaderboardView(leaderboard, leaderboardKey, LEADERBOARD_ROWS, leaderboardQuery));
+            screen.addLine("");
+            screen.addLine(LEADERBOARD_PROMPT);
+            break;
+        case State::PLAY_AGAIN:
+            if (core.isOver()) board.displayStats(core, core.isWon(), finishedMs);
+            else board.displayBoard(core);
+            screen.addLine("");
+            screen.addLine("Main lagi? (y/n): ");
+            break;
+        case State::CLOSED:
+            screen.addLine("");
+            screen.addLine("Terima kasih telah bermain SYMBOLIC NUMBLER!");
+            break;
+    }
+    output += screen.composeFrame();
+}
@@ -0,0 +1,116 @@
+/*
+ * SYMBOLIC NUMBLER - SESI PERMAINAN BERBASIS PERISTIWA
+ *
+ * Satu objek per koneksi menggantikan getChar/clearScreen global: sesi
+ * menerima potongan input (berapa pun tombolnya), menjalankan semua
+ * tombol, lalu menyusun tepat satu frame diff ke buffer keluaran. Sesi
+ * tidak pernah memblokir sehingga ribuan sesi bisa dijalankan oleh satu
+ * loop peristiwa.
+ */
+#ifndef SYMBOLIC_SESSION_H
+#define SYMBOLIC_SESSION_H
+
+#include "symbolic_board.h"
+#include "symbolic_candidates.h"
+#include "symbolic_core.h"
+#include "symbolic_leaderboard.h"
+#include "symbolic_recording.h"
+#include "symbolic_screen.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GameSession {
+public:
+    enum class State {
+        MENU,
+        CUSTOM_DIGITS,
+        CUSTOM_ATTEMPTS,
+        INSTRUCTIONS,
+        GUESSING,
+        NOTICE,
+        NAME_ENTRY,
+        LEADERBOARD,
+        PLAY_AGAIN,
+        CLOSED
+    };
+
+private:
+    static constexpr size_t LEADERBOARD_ROWS = 10;
+    static constexpr size_t MAX_LINE_INPUT = 15;
+    static constexpr size_t CANDIDATES_SHOWN = 6;
+
+    GameCore core;
+    Rng& rng;
+    LeaderboardStore& leaderboard;
+    RecordingWriter* recorder;   // nullptr = tanpa rekaman
+    ScreenBuffer screen;
+    BoardRenderer board{screen};
+
+    State state = State::MENU;
+    State afterLeaderboard = State::MENU;
+    RankingKey leaderboardKey;     // Kelompok yang sedang ditampilkan; tombol digit menggantinya
+    RankingQuery leaderboardQuery; // Skor yang baru dimasukkan, kosong dari menu
+    int columns = 0;       // Lebar terminal klien, 0 jika tidak diketahui
+    int rows = 0;          // Tinggi terminal klien, 0 jika tidak diketahui
+    int customDigits = 0;
+    bool marathon = false; // Layar kustom sedang meminta pengaturan maraton
+    std::string input;     // Tebakan atau teks yang sedang diketik
+    std::string message;   // Pesan kesalahan untuk layar berikutnya
+    CandidateTracker candidates; // Angka yang masih mungkin; JARANG setelah tebakan pertama
+    std::string candidateText;   // Baris dari tombol K, dihapus saat tebakan dikirim
+    bool lastWasReturn = false;
+
+    // Mode speedrun: jam dimulai saat papan pertama muncul
+    using Clock = std::chrono::steady_clock;
+    bool timed = false;
+    Clock::time_point inputAt;   // Waktu potongan input yang sedang diproses
+    Clock::time_point startedAt;
+    int64_t finishedMs = -1;     // Waktu menang/kalah, -1 selama bermain
+    int64_t elapsedMs(Clock::time_point at) const;
+
+    // Rekaman permainan yang sedang berjalan
+    int64_t gameStartedAt = 0;   // Milidetik sejak epoch
+    std::vector<uint32_t> guessMs;
+    bool unrecorded = false;     // Permainan sudah dimulai tetapi belum diserahkan ke perekam
+    void recordGame(const std::string& name);
+
+    std::string output;
+
+    void startGame(int digits, int attempts, bool timedMode = false, const std::string& fixedTarget = "");
+    int score() const;
+    void handleKey(char ch);
+    void handleLineKey(char ch, bool digitsOnly, size_t maxLength = MAX_LINE_INPUT);
+    std::string customPrompt(bool digitsStep) const;
+    void submitLine();
+    void render();
+
+public:
+    GameSession(Rng& generator, LeaderboardStore& store, RecordingWriter* gameRecorder = nullptr);
+    ~GameSession(); // Permainan yang terputus di tengah jalan tetap direkam
+    GameSession(const GameSession&) = delete;
+    GameSession& operator=(const GameSession&) = delete;
+
+    // Menyusun frame pertama (menu utama)
+    void start();
+
+    // Memproses semua tombol dalam satu potongan input lalu menyusun satu frame
+    void handleInput(const char* data, size_t size);
+
+    // Ukuran terminal klien berubah (misalnya dari telnet NAWS); lebar berlaku mulai
+    // permainan berikutnya, tinggi langsung dengan frame baru jika berubah
+    void resize(int newColumns, int newRows);
+
+    // Byte yang belum dikirim; pemanggil mengosongkan setelah menulis
+    std::string& pendingOutput() { return output; }
+
+    State getState() const { return state; }
+    bool isClosed() const { return state == State::CLOSED; }
+    const GameCore& getCore() const { return core; }
+    const ScreenBuffer& getScreen() const { return screen; }
+};
+
+#endif
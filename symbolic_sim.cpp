@@ -0,0 +1,80 @@
+#include "symbolic_sim.h"
+#include "symbolic_strategy.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+// Memainkan target [begin, end) di satu thread dengan status lokal sendiri
+void simulateWorker(const GameConfig& config, GuessStrategy& strategy, const PackedCandidates& targets,
+                    size_t begin, size_t end, uint64_t strategySeed, SimulationStats& local) {
+    GameCore game(config.digits, config.maxAttempts);
+
+    for (size_t g = begin; g < end; g++) {
+        game.startNewGame(config.digits, config.maxAttempts, targets.toString(g));
+        strategy.reset(config);
+        Rng rng(strategySeed + g); // Per permainan, jadi hasil tidak bergantung pembagian thread
+        while (!game.isOver()) {
+            game.submitGuess(strategy.nextGuess(game, rng));
+        }
+        local.games++;
+        if (game.isWon()) {
+            local.wins++;
+            local.attemptsHistogram[game.getCurrentAttempt()]++;
+            local.totalScore += game.calculateScore();
+        }
+    }
+}
+
+} // namespace
+
+bool runSimulation(const GameConfig& config, const string& strategyName, uint64_t games,
+                   unsigned threads, uint64_t seed, SimulationStats& stats) {
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+    threads = static_cast<unsigned>(min<uint64_t>(threads, max<uint64_t>(games, 1)));
+
+    vector<unique_ptr<GuessStrategy>> strategies;
+    for (unsigned t = 0; t < threads; t++) {
+        strategies.push_back(createStrategy(strategyName));
+        if (!strategies.back()) return false;
+    }
+
+    stats = SimulationStats();
+    stats.config = config;
+    stats.strategy = strategyName;
+    stats.attemptsHistogram.assign(config.maxAttempts + 1, 0);
+    vector<SimulationStats> locals(threads, stats);
+
+    auto start = chrono::steady_clock::now();
+    // Target dibuat sekaligus dari benih dan tebakan acak strategi memakai benih
+    // per permainan, jadi hasil sama berapa pun jumlah thread
+    PackedCandidates targets;
+    generateTargets(seed, config.digits, games, targets, threads);
+    uint64_t strategySeed = Rng::splitmix64(seed);
+
+    vector<thread> workers;
+    size_t begin = 0;
+    for (unsigned t = 0; t < threads; t++) {
+        size_t share = games / threads + (t < games % threads ? 1 : 0);
+        workers.emplace_back(simulateWorker, cref(config), ref(*strategies[t]), cref(targets), begin, begin + share,
+                             strategySeed, ref(locals[t]));
+        begin += share;
+    }
+    for (auto& worker : workers) worker.join();
+    stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    for (const auto& local : locals) {
+        stats.games += local.games;
+        stats.wins += local.wins;
+        stats.totalScore += local.totalScore;
+        for (size_t i = 0; i < stats.attemptsHistogram.size(); i++) {
+            stats.attemptsHistogram[i] += local.attemptsHistogram[i];
+        }
+    }
+    return true;
+}
@@ -0,0 +1,36 @@
+/*
+ * SYMBOLIC NUMBLER - SIMULASI MASSAL PARALEL
+ *
+ * Memainkan banyak permainan tanpa konsol di semua inti CPU memakai
+ * strategi penebak otomatis, untuk menyetel tingkat kesulitan dan skor.
+ */
+#ifndef SYMBOLIC_SIM_H
+#define SYMBOLIC_SIM_H
+
+#include "symbolic_core.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Hasil simulasi untuk satu pengaturan (digits, maxAttempts)
+struct SimulationStats {
+    GameConfig config;
+    std::string strategy;
+    uint64_t games = 0;
+    uint64_t wins = 0;
+    // attemptsHistogram[n] = jumlah kemenangan dalam n percobaan (indeks 0 tidak dipakai)
+    std::vector<uint64_t> attemptsHistogram;
+    uint64_t totalScore = 0;
+    double seconds = 0.0;
+
+    double winRate() const { return games ? static_cast<double>(wins) / games : 0.0; }
+    double gamesPerSecond() const { return seconds > 0 ? games / seconds : 0.0; }
+};
+
+// Menjalankan `games` permainan dibagi ke `threads` thread (0 = semua inti).
+// Semua target dibuat di muka dari seed (digits byte per permainan).
+bool runSimulation(const GameConfig& config, const std::string& strategyName, uint64_t games,
+                   unsigned threads, uint64_t seed, SimulationStats& stats);
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * SYMBOLIC NUMBLER - PROGRAM SIMULASI
+ *
+ * Contoh:
+ *   symbolic_sim --strategy consistent --games 1000000
+ *   symbolic_sim --digits 5 --attempts 6 --threads 8 --strategy bisect
+ */
+#include "symbolic_candidates.h"
+#include "symbolic_sim.h"
+#include "symbolic_strategy.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " [opsi]\n"
+         << "  --digits N      Jumlah digit (bawaan: semua preset menu)\n"
+         << "  --attempts N    Jumlah percobaan maksimum\n"
+         << "  --games N       Jumlah permainan per pengaturan (bawaan: 10000)\n"
+         << "  --threads N     Jumlah thread (bawaan: semua inti)\n"
+         << "  --strategy S    Strategi penebak:";
+    for (const auto& name : strategyNames()) cout << " " << name;
+    cout << " (bawaan: consistent)\n"
+         << "  --seed N        Benih acak (bawaan: 1)\n";
+}
+
+void printStats(const SimulationStats& stats) {
+    cout << "\n[" << stats.config.digits << " digit, " << stats.config.maxAttempts
+         << " percobaan, strategi " << stats.strategy << "]\n";
+    cout << fixed << setprecision(2);
+    cout << "  Permainan      : " << stats.games << " dalam " << stats.seconds << " detik ("
+         << setprecision(0) << stats.gamesPerSecond() << " permainan/detik)\n";
+    cout << setprecision(2);
+    cout << "  Tingkat menang : " << stats.winRate() * 100.0 << "%\n";
+    if (stats.wins > 0) {
+        double totalAttempts = 0;
+        for (size_t n = 1; n < stats.attemptsHistogram.size(); n++) {
+            totalAttempts += static_cast<double>(n) * stats.attemptsHistogram[n];
+        }
+        cout << "  Rata-rata      : " << totalAttempts / stats.wins << " percobaan, skor "
+             << static_cast<double>(stats.totalScore) / stats.wins << " per kemenangan\n";
+    }
+    cout << "  Distribusi percobaan:\n";
+    for (size_t n = 1; n < stats.attemptsHistogram.size(); n++) {
+        double share = stats.games ? 100.0 * stats.attemptsHistogram[n] / stats.games : 0.0;
+        cout << "    " << setw(2) << n << " : " << setw(10) << stats.attemptsHistogram[n] << "  ("
+             << setw(6) << share << "%)\n";
+    }
+    double lossShare = stats.games ? 100.0 * (stats.games - stats.wins) / stats.games : 0.0;
+    cout << "    kalah: " << setw(10) << stats.games - stats.wins << "  (" << setw(6) << lossShare
+         << "%)\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int digits = 0, attempts = 0;
+    uint64_t games = 10000, seed = 1;
+    unsigned threads = 0;
+    string strategy = "consistent";
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--digits") == 0 && hasValue) digits = atoi(argv[++i]);
+        else if (strcmp(arg, "--attempts") == 0 && hasValue) attempts = atoi(argv[++i]);
+        else if (strcmp(arg, "--games") == 0 && hasValue) games = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(arg, "--threads") == 0 && hasValue) threads = static_cast<unsigned>(atoi(argv[++i]));
+        else if (strcmp(arg, "--strategy") == 0 && hasValue) strategy = argv[++i];
+        else if (strcmp(arg, "--seed") == 0 && hasValue) seed = strtoull(argv[++i], nullptr, 10);
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Tanpa --digits, jalankan semua preset dari menu utama
+    vector<GameConfig> configs;
+    if (digits > 0) {
+        if (digits > 9 || attempts < 0) {
+            cerr << "Jumlah digit harus 1-9.\n";
+            return 1;
+        }
+        // Tanpa pelacak kandidat strategi ini hanya akan menebak acak
+        if (strategy == "consistent" && digits > CANDIDATE_MAX_DIGITS) {
+            cerr << "Strategi consistent hanya sampai " << CANDIDATE_MAX_DIGITS << " digit.\n";
+            return 1;
+        }
+        configs.push_back({digits, attempts > 0 ? attempts : 6});
+    } else {
+        configs = {{3, 6}, {4, 6}, {5, 6}, {6, 8}};
+    }
+
+    for (const auto& config : configs) {
+        SimulationStats stats;
+        if (!runSimulation(config, strategy, games, threads, seed, stats)) {
+            cerr << "Strategi tidak dikenal: " << strategy << "\n";
+            printUsage(argv[0]);
+            return 1;
+        }
+        printStats(stats);
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * SYMBOLIC NUMBLER - PROGRAM PENCARI TEBAKAN
+ *
+ * Riwayat ditulis sebagai TEBAKAN:HASIL:PANAH, panah U (target lebih
+ * tinggi) atau D (target lebih rendah). Contoh:
+ *   symbolic_solve --digits 4 --scoring entropy 1234:GYXX:U 5678:XXYX:D
+ *   symbolic_solve --digits 4 --book symbolic_book.bin 0123:XYXX:U
+ */
+#include "symbolic_book.h"
+#include "symbolic_candidates.h"
+#include "symbolic_solver.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " [opsi] [TEBAKAN:HASIL:PANAH ...]\n"
+         << "  --digits N          Jumlah digit, 1-" << CANDIDATE_MAX_DIGITS << " (bawaan: 4)\n"
+         << "  --scoring S         minimax | expected | entropy (bawaan: minimax)\n"
+         << "  --budget-ms N       Batas waktu per langkah (bawaan: 1000)\n"
+         << "  --threads N         Jumlah thread (bawaan: semua inti)\n"
+         << "  --candidates-only   Hanya menebak angka yang masih mungkin\n"
+         << "  --book FILE         Pakai buku pembukaan selama riwayat masih di dalamnya\n";
+}
+
+bool parseRecord(const string& text, int digits, GuessRecord& record) {
+    size_t first = text.find(':');
+    size_t second = text.find(':', first + 1);
+    if (first == string::npos || second == string::npos) return false;
+    record.guess = text.substr(0, first);
+    record.result = text.substr(first + 1, second - first - 1);
+    string arrow = text.substr(second + 1);
+    if (static_cast<int>(record.guess.size()) != digits || record.result.size() != record.guess.size()) return false;
+    for (char c : record.guess) if (c < '0' || c > '9') return false;
+    for (char c : record.result) if (c != 'G' && c != 'Y' && c != 'X') return false;
+    if (arrow == "U" || arrow == "u") record.hint = ArrowHint::UP;
+    else if (arrow == "D" || arrow == "d") record.hint = ArrowHint::DOWN;
+    else if (arrow.empty() || arrow == "-") record.hint = ArrowHint::NONE;
+    else return false;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int digits = 4;
+    SolverOptions options;
+    vector<string> recordTexts;
+    string bookPath;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--digits") == 0 && hasValue) {
+            digits = atoi(argv[++i]);
+            if (digits < 1 || digits > CANDIDATE_MAX_DIGITS) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+        else if (strcmp(arg, "--scoring") == 0 && hasValue) {
+            if (!parseScoring(argv[++i], options.scoring)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(arg, "--budget-ms") == 0 && hasValue) options.budgetMs = atoi(argv[++i]);
+        else if (strcmp(arg, "--threads") == 0 && hasValue) options.threads = static_cast<unsigned>(atoi(argv[++i]));
+        else if (strcmp(arg, "--candidates-only") == 0) options.candidatesOnly = true;
+        else if (strcmp(arg, "--book") == 0 && hasValue) bookPath = argv[++i];
+        else if (arg[0] == '-') {
+            printUsage(argv[0]);
+            return 1;
+        } else recordTexts.push_back(arg);
+    }
+
+    vector<GuessRecord> history;
+    for (const auto& text : recordTexts) {
+        GuessRecord record;
+        if (!parseRecord(text, digits, record)) {
+            cerr << "Riwayat tidak valid: " << text << "\n";
+            return 1;
+        }
+        history.push_back(record);
+    }
+
+    OpeningBook book;
+    if (!bookPath.empty() && !book.open(bookPath)) {
+        cerr << "Buku pembukaan tidak bisa dibuka: " << bookPath << "\n";
+        return 1;
+    }
+
+    SolverResult result;
+    if (!solveNextGuess(book, digits, history, options, result)) {
+        cerr << "Tidak ada angka yang cocok dengan riwayat ini.\n";
+        return 1;
+    }
+
+    cout << "Tebakan          : " << result.guess << "\n"
+         << "Sumber           : " << (result.fromBook ? "buku pembukaan" : "pencarian") << "\n";
+    // Buku hanya menyimpan tebakan dan jumlah kandidat, bukan skor pencariannya
+    if (!result.fromBook) cout << "Skor (" << scoringName(options.scoring) << ") : " << result.score << "\n";
+    cout << "Kandidat tersisa : " << result.candidates << "\n";
+    if (!result.fromBook) {
+        cout << "Tebakan dinilai  : " << result.guessesEvaluated << " (dipangkas " << result.guessesPruned << ")\n"
+             << "Selesai          : " << (result.complete ? "ya" : "tidak, batas waktu habis") << "\n";
+    }
+    cout << "Waktu            : " << result.seconds * 1000.0 << " ms\n";
+    return 0;
+}
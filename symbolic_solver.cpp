@@ -0,0 +1,368 @@
+#include "symbolic_solver.h"
+#include "symbolic_candidates.h"
+#include "symbolic_feedback.h"
+#include "symbolic_strategy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+using Clock = chrono::steady_clock;
+
+// Kandidat dinilai per blok agar pemangkasan bisa dicek secara berkala
+constexpr size_t SCORE_BLOCK = 1024;
+// Jumlah tebakan yang diambil sekaligus dari antrean sendiri
+constexpr uint32_t GUESS_CHUNK = 16;
+// Sampai 6 digit semua angka dicoba sebagai tebakan; di atasnya sisa ruang
+// angka diwakili sampel sebanyak ini agar persiapan tetap di dalam anggaran
+constexpr int FULL_GUESS_SPACE_DIGITS = 6;
+constexpr uint64_t SAMPLED_EXTRA_GUESSES = 100000;
+
+void formatNumber(uint64_t value, int digits, string& out) {
+    out.assign(digits, '0');
+    for (int i = digits - 1; i >= 0; i--) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+// Double non-negatif berurutan sama dengan pola bitnya sebagai uint64
+uint64_t scoreBits(double score) {
+    uint64_t bits;
+    memcpy(&bits, &score, sizeof bits);
+    return bits;
+}
+
+double bitsScore(uint64_t bits) {
+    double score;
+    memcpy(&score, &bits, sizeof score);
+    return score;
+}
+
+/*
+ * ANTREAN RENTANG UNTUK PENCURIAN KERJA
+ * [begin, end) dikemas dalam satu atomik 64-bit. Pemilik mengambil dari
+ * depan, pencuri mengambil separuh dari belakang; keduanya memakai CAS.
+ */
+class RangeDeque {
+private:
+    atomic<uint64_t> range{0};
+    static uint64_t pack(uint32_t begin, uint32_t end) { return (static_cast<uint64_t>(begin) << 32) | end; }
+
+public:
+    void assign(uint32_t begin, uint32_t end) { range.store(pack(begin, end)); }
+
+    uint32_t remaining() const {
+        uint64_t r = range.load(memory_order_relaxed);
+        uint32_t begin = static_cast<uint32_t>(r >> 32), end = static_cast<uint32_t>(r);
+        return end > begin ? end - begin : 0;
+    }
+
+    bool popFront(uint32_t chunk, uint32_t& begin, uint32_t& end) {
+        uint64_t r = range.load();
+        while (true) {
+            uint32_t b = static_cast<uint32_t>(r >> 32), e = static_cast<uint32_t>(r);
+            if (b >= e) return false;
+            uint32_t nb = min(e, b + chunk);
+            if (range.compare_exchange_weak(r, pack(nb, e))) {
+                begin = b;
+                end = nb;
+                return true;
+            }
+        }
+    }
+
+    bool stealHalf(uint32_t& begin, uint32_t& end) {
+        uint64_t r = range.load();
+        while (true) {
+            uint32_t b = static_cast<uint32_t>(r >> 32), e = static_cast<uint32_t>(r);
+            if (e <= b + 1) return false;
+            uint32_t mid = b + (e - b) / 2;
+            if (range.compare_exchange_weak(r, pack(b, mid))) {
+                begin = mid;
+                end = e;
+                return true;
+            }
+        }
+    }
+};
+
+struct Candidate {
+    double score;
+    bool isCandidate;
+    uint64_t value;
+
+    // Skor lebih kecil, lalu utamakan tebakan yang bisa langsung menang
+    bool betterThan(const Candidate& other) const {
+        if (score != other.score) return score < other.score;
+        if (isCandidate != other.isCandidate) return isCandidate;
+        return value < other.value;
+    }
+};
+
+struct SearchShared {
+    int digits;
+    SolverScoring scoring;
+    const PackedCandidates* candidates;
+    const vector<uint32_t>* values;   // Nilai kandidat, terurut naik
+    const vector<uint32_t>* guessOrder;
+    size_t candidateGuesses;          // guessOrder[0..candidateGuesses) adalah kandidat
+    const vector<double>* entropyTable;
+    Clock::time_point deadline;
+    atomic<uint64_t> bound;           // Skor terbaik sejauh ini (bit double)
+    atomic<bool> timedOut{false};
+    vector<RangeDeque>* deques;
+};
+
+struct WorkerResult {
+    Candidate best{numeric_limits<double>::infinity(), false, 0};
+    bool found = false;
+    size_t evaluated = 0;
+    size_t pruned = 0;
+};
+
+// Menilai satu tebakan; false jika dipangkas karena melewati batas terbaik
+bool scoreGuess(SearchShared& shared, uint64_t guessValue, vector<uint32_t>& buckets, vector<uint32_t>& touched,
+                vector<uint16_t>& codes, string& guessText, double& scoreOut) {
+    const PackedCandidates& candidates = *shared.candidates;
+    const vector<uint32_t>& values = *shared.values;
+    const size_t n = candidates.size();
+    formatNumber(guessValue, shared.digits, guessText);
+
+    // Kandidat di bawah posisi ini lebih kecil dari tebakan (panah turun)
+    size_t below = lower_bound(values.begin(), values.end(), guessValue) - values.begin();
+
+    uint64_t worst = 0, sumSquares = 0;
+    double sumEntropy = 0.0;
+    bool prunedEarly = false;
+    for (size_t begin = 0; begin < n && !prunedEarly; begin += SCORE_BLOCK) {
+        size_t end = min(n, begin + SCORE_BLOCK);
+        scoreGuessBatch(guessText, candidates, begin, end, codes.data());
+        for (size_t i = begin; i < end; i++) {
+            uint32_t arrow = (i < below) ? 2 : (values[i] == guessValue ? 0 : 1);
+            uint32_t bucket = codes[i - begin] * 3u + arrow;
+            uint32_t count = buckets[bucket]++;
+            if (count == 0) touched.push_back(bucket);
+            worst = max<uint64_t>(worst, count + 1);
+            sumSquares += 2ull * count + 1;
+            sumEntropy += (*shared.entropyTable)[count + 1] - (*shared.entropyTable)[count];
+        }
+
+        double partial = shared.scoring == SolverScoring::MINIMAX    ? static_cast<double>(worst)
+                         : shared.scoring == SolverScoring::EXPECTED ? static_cast<double>(sumSquares)
+                                                                     : sumEntropy;
+        if (partial > bitsScore(shared.bound.load(memory_order_relaxed))) prunedEarly = true;
+        scoreOut = partial;
+    }
+
+    for (uint32_t bucket : touched) buckets[bucket] = 0;
+    touched.clear();
+    return !prunedEarly;
+}
+
+void searchWorker(SearchShared& shared, unsigned self, WorkerResult& out) {
+    vector<uint32_t> buckets(static_cast<size_t>(winningCode(shared.digits) + 1) * 3, 0);
+    vector<uint32_t> touched;
+    vector<uint16_t> codes(SCORE_BLOCK);
+    string guessText;
+    vector<RangeDeque>& deques = *shared.deques;
+
+    while (true) {
+        uint32_t begin, end;
+        if (!deques[self].popFront(GUESS_CHUNK, begin, end)) {
+            // Antrean sendiri habis: curi separuh dari antrean terpanjang
+            unsigned victim = self;
+            uint32_t most = 0;
+            for (unsigned t = 0; t < deques.size(); t++) {
+                uint32_t left = deques[t].remaining();
+                if (t != self && left > most) {
+                    most = left;
+                    victim = t;
+                }
+            }
+            if (victim == self || !deques[victim].stealHalf(begin, end)) {
+                if (most == 0) return;
+                continue;
+            }
+            deques[self].assign(begin, end);
+            continue;
+        }
+
+        for (uint32_t index = begin; index < end; index++) {
+            if (Clock::now() >= shared.deadline) {
+                shared.timedOut.store(true);
+                return;
+            }
+            uint64_t guessValue = (*shared.guessOrder)[index];
+            double score = 0.0;
+            if (!scoreGuess(shared, guessValue, buckets, touched, codes, guessText, score)) {
+                out.pruned++;
+                continue;
+            }
+            out.evaluated++;
+
+            Candidate current{score, index < shared.candidateGuesses, guessValue};
+            if (!out.found || current.betterThan(out.best)) {
+                out.best = current;
+                out.found = true;
+                uint64_t bits = scoreBits(score);
+                uint64_t seen = shared.bound.load();
+                while (bits < seen && !shared.bound.compare_exchange_weak(seen, bits)) {
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+vector<GuessRecord> historyOf(const GameCore& game) {
+    vector<GuessRecord> history;
+    for (size_t i = 0; i < game.getGuessCount(); i++) {
+        history.push_back({game.getGuess(i), game.getResult(i), game.getHints()[i]});
+    }
+    return history;
+}
+
+bool parseScoring(const string& name, SolverScoring& scoring) {
+    if (name == "minimax") scoring = SolverScoring::MINIMAX;
+    else if (name == "expected") scoring = SolverScoring::EXPECTED;
+    else if (name == "entropy") scoring = SolverScoring::ENTROPY;
+    else return false;
+    return true;
+}
+
+const char* scoringName(SolverScoring scoring) {
+    switch (scoring) {
+        case SolverScoring::MINIMAX: return "minimax";
+        case SolverScoring::EXPECTED: return "expected";
+        default: return "entropy";
+    }
+}
+
+bool consistentCandidates(int digits, const vector<GuessRecord>& history, PackedCandidates& out) {
+    if (digits < 1 || digits > CANDIDATE_MAX_DIGITS) return false;
+
+    // Panah mempersempit rentang, lalu umpan balik menyaring isinya
+    uint64_t lo = 0, hi = powerOfTen(digits);
+    for (const auto& step : history) {
+        uint64_t value = stoull(step.guess);
+        if (step.hint == ArrowHint::UP) lo = max(lo, value + 1);
+        else if (step.hint == ArrowHint::DOWN) hi = min(hi, value);
+    }
+    if (lo >= hi) return false;
+
+    out = PackedCandidates::fromRange(digits, lo, hi);
+    PackedCandidates scratch;
+    vector<uint16_t> codes;
+    for (const auto& step : history) {
+        filterCandidates(out, step.guess, step.result, step.hint, scratch, codes);
+        swap(out, scratch);
+    }
+    return true;
+}
+
+bool solveNextGuess(int digits, const vector<GuessRecord>& history, const SolverOptions& options,
+                    SolverResult& result) {
+    auto start = Clock::now();
+    result = SolverResult();
+
+    PackedCandidates candidates;
+    if (!consistentCandidates(digits, history, candidates)) return false;
+    const size_t n = candidates.size();
+    result.candidates = n;
+    if (n == 0) return false;
+
+    vector<uint32_t> values(n);
+    for (size_t i = 0; i < n; i++) values[i] = static_cast<uint32_t>(candidates.value(i));
+    if (n <= 2) {
+        result.guess = candidates.toString(0);
+        result.score = static_cast<double>(n - 1);
+        result.complete = true;
+        result.seconds = chrono::duration<double>(Clock::now() - start).count();
+        return true;
+    }
+
+    // Urutan tebakan: kandidat dulu (bisa menang), lalu sisa ruang angka
+    // (di atas FULL_GUESS_SPACE_DIGITS hanya sampel berjarak sama)
+    vector<uint32_t> guessOrder(values);
+    if (!options.candidatesOnly) {
+        const uint64_t total = powerOfTen(digits);
+        if (digits <= FULL_GUESS_SPACE_DIGITS) {
+            size_t next = 0;
+            for (uint64_t value = 0; value < total; value++) {
+                if (next < n && values[next] == value) next++;
+                else guessOrder.push_back(static_cast<uint32_t>(value));
+            }
+        } else {
+            guessOrder.reserve(n + SAMPLED_EXTRA_GUESSES);
+            for (uint64_t k = 0; k < SAMPLED_EXTRA_GUESSES; k++) {
+                uint32_t value = static_cast<uint32_t>(k * total / SAMPLED_EXTRA_GUESSES);
+                if (!binary_search(values.begin(), values.end(), value)) guessOrder.push_back(value);
+            }
+        }
+    }
+
+    // c * log2(c) untuk skor entropi bertahap
+    vector<double> entropyTable(n + 1, 0.0);
+    for (size_t c = 2; c <= n; c++) entropyTable[c] = c * log2(static_cast<double>(c));
+
+    unsigned threads = options.threads ? options.threads : max(1u, thread::hardware_concurrency());
+    threads = static_cast<unsigned>(min<size_t>(threads, guessOrder.size()));
+
+    vector<RangeDeque> deques(threads);
+    const uint32_t total = static_cast<uint32_t>(guessOrder.size());
+    for (unsigned t = 0; t < threads; t++) {
+        deques[t].assign(static_cast<uint32_t>(static_cast<uint64_t>(total) * t / threads),
+                         static_cast<uint32_t>(static_cast<uint64_t>(total) * (t + 1) / threads));
+    }
+
+    SearchShared shared;
+    shared.digits = digits;
+    shared.scoring = options.scoring;
+    shared.candidates = &candidates;
+    shared.values = &values;
+    shared.guessOrder = &guessOrder;
+    shared.candidateGuesses = n;
+    shared.entropyTable = &entropyTable;
+    shared.deadline = start + chrono::milliseconds(options.budgetMs);
+    shared.bound.store(scoreBits(numeric_limits<double>::infinity()));
+    shared.deques = &deques;
+
+    vector<WorkerResult> workerResults(threads);
+    vector<thread> workers;
+    for (unsigned t = 1; t < threads; t++) {
+        workers.emplace_back(searchWorker, ref(shared), t, ref(workerResults[t]));
+    }
+    searchWorker(shared, 0, workerResults[0]);
+    for (auto& worker : workers) worker.join();
+
+    Candidate best{numeric_limits<double>::infinity(), true, values[0]};
+    bool found = false;
+    for (const auto& worker : workerResults) {
+        result.guessesEvaluated += worker.evaluated;
+        result.guessesPruned += worker.pruned;
+        if (worker.found && (!found || worker.best.betterThan(best))) {
+            best = worker.best;
+            found = true;
+        }
+    }
+
+    // Tanpa satu pun tebakan selesai dinilai, kandidat pertama tetap sah
+    formatNumber(best.value, digits, result.guess);
+    result.score = found ? best.score : numeric_limits<double>::infinity();
+    if (found && options.scoring == SolverScoring::EXPECTED) result.score /= n;
+    if (found && options.scoring == SolverScoring::ENTROPY) result.score /= n;
+    result.complete = !shared.timedOut.load();
+    result.seconds = chrono::duration<double>(Clock::now() - start).count();
+    return true;
+}
@@ -0,0 +1,65 @@
+/*
+ * SYMBOLIC NUMBLER - PENCARI TEBAKAN OPTIMAL
+ *
+ * Dari riwayat tebakan, hasil dan panah, mencari tebakan berikutnya yang
+ * meminimalkan sisa kandidat (minimax gaya Knuth, rata-rata, atau entropi).
+ * Pencarian paralel dengan pencurian kerja antar thread, pemangkasan dini
+ * dan batas waktu per langkah.
+ */
+#ifndef SYMBOLIC_SOLVER_H
+#define SYMBOLIC_SOLVER_H
+
+#include "symbolic_core.h"
+#include "symbolic_feedback.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+enum class SolverScoring {
+    MINIMAX,  // Ukuran partisi terbesar (kasus terburuk)
+    EXPECTED, // Rata-rata sisa kandidat
+    ENTROPY   // Informasi yang didapat (entropi partisi)
+};
+
+struct SolverOptions {
+    SolverScoring scoring = SolverScoring::MINIMAX;
+    unsigned threads = 0;        // 0 = semua inti
+    int budgetMs = 1000;         // Batas waktu per langkah
+    bool candidatesOnly = false; // Hanya menebak angka yang masih mungkin
+};
+
+// Satu langkah riwayat seperti yang terlihat oleh pemain
+struct GuessRecord {
+    std::string guess;
+    std::string result;
+    ArrowHint hint;
+};
+
+struct SolverResult {
+    std::string guess;
+    double score = 0.0;           // Nilai metrik (lebih kecil lebih baik; entropi: jumlah c*log2(c) / n)
+    size_t candidates = 0;        // Jumlah angka yang masih mungkin
+    size_t guessesEvaluated = 0;
+    size_t guessesPruned = 0;
+    bool complete = false;        // false jika batas waktu habis sebelum semua tebakan dinilai
+    bool fromBook = false;        // Diambil dari buku pembukaan, bukan dicari
+    double seconds = 0.0;
+};
+
+// Riwayat pemain dari status permainan (tanpa membaca target)
+std::vector<GuessRecord> historyOf(const GameCore& game);
+
+bool parseScoring(const std::string& name, SolverScoring& scoring);
+const char* scoringName(SolverScoring scoring);
+
+// Semua angka yang cocok dengan riwayat (panah dulu, lalu umpan balik);
+// false jika digits di luar 1..CANDIDATE_MAX_DIGITS (ruang angka harus muat
+// di memori) atau panah saling bertentangan
+bool consistentCandidates(int digits, const std::vector<GuessRecord>& history, PackedCandidates& out);
+
+// Mengembalikan false jika riwayat tidak konsisten (tidak ada kandidat)
+bool solveNextGuess(int digits, const std::vector<GuessRecord>& history, const SolverOptions& options,
+                    SolverResult& result);
+
+#endif
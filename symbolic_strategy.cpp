@@ -0,0 +1,96 @@
+#include "symbolic_strategy.h"
+#include "symbolic_candidates.h"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+namespace {
+
+// Menulis angka sebagai string dengan nol di depan
+void formatNumber(uint64_t value, int digits, string& out) {
+    out.assign(digits, '0');
+    for (int i = digits - 1; i >= 0; i--) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+// Tebakan acak murni, tanpa memakai umpan balik
+class RandomStrategy : public GuessStrategy {
+public:
+    const char* name() const override { return "random"; }
+    string nextGuess(const GameCore& game, Rng& rng) override {
+        return generateTarget(game.getDigits(), rng);
+    }
+};
+
+// Pencarian biner yang hanya memakai petunjuk panah
+class BisectStrategy : public GuessStrategy {
+public:
+    const char* name() const override { return "bisect"; }
+    string nextGuess(const GameCore& game, Rng& rng) override {
+        (void)rng;
+        uint64_t lo = 0;
+        uint64_t hi = powerOfTen(game.getDigits()) - 1;
+        const auto& hints = game.getHints();
+        for (size_t i = 0; i < game.getGuessCount(); i++) {
+            uint64_t value = stoull(game.getGuess(i));
+            if (hints[i] == ArrowHint::UP) lo = max(lo, value + 1);
+            else if (hints[i] == ArrowHint::DOWN && value > 0) hi = min(hi, value - 1);
+        }
+        string guess;
+        formatNumber(lo + (hi - lo) / 2, game.getDigits(), guess);
+        return guess;
+    }
+};
+
+// Memilih kandidat acak yang masih cocok dengan seluruh riwayat
+class ConsistentStrategy : public GuessStrategy {
+private:
+    CandidateTracker tracker; // Hanya tebakan baru yang disaring di setiap langkah
+
+public:
+    const char* name() const override { return "consistent"; }
+
+    void reset(const GameConfig& config) override { tracker.reset(config.digits); }
+
+    string nextGuess(const GameCore& game, Rng& rng) override {
+        if (game.getGuessCount() == 0) return generateTarget(game.getDigits(), rng);
+        tracker.sync(game);
+        if (tracker.count() == 0) return generateTarget(game.getDigits(), rng);
+        return tracker.sample(rng);
+    }
+};
+
+} // namespace
+
+unique_ptr<GuessStrategy> createStrategy(const string& name) {
+    if (name == "random") return make_unique<RandomStrategy>();
+    if (name == "bisect") return make_unique<BisectStrategy>();
+    if (name == "consistent") return make_unique<ConsistentStrategy>();
+    return nullptr;
+}
+
+vector<string> strategyNames() {
+    return {"random", "bisect", "consistent"};
+}
+
+void filterCandidates(const PackedCandidates& source, const string& guess, const string& result,
+                      ArrowHint hint, PackedCandidates& out, vector<uint16_t>& codes) {
+    const uint16_t wanted = feedbackCode(result);
+    const uint64_t guessValue = stoull(guess);
+    codes.resize(source.size());
+    scoreGuessBatch(guess, source, 0, source.size(), codes.data());
+
+    if (out.getDigits() != source.getDigits()) out = PackedCandidates(source.getDigits());
+    else out.clear();
+    for (size_t i = 0; i < source.size(); i++) {
+        if (codes[i] != wanted) continue;
+        uint64_t value = source.value(i);
+        if (hint == ArrowHint::UP && value <= guessValue) continue;
+        if (hint == ArrowHint::DOWN && value >= guessValue) continue;
+        out.push(value);
+    }
+}
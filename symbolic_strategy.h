@@ -0,0 +1,37 @@
+/*
+ * SYMBOLIC NUMBLER - STRATEGI PENEBAK OTOMATIS
+ *
+ * Strategi hanya boleh melihat riwayat tebakan, hasil dan petunjuk panah
+ * dari GameCore, bukan targetnya.
+ */
+#ifndef SYMBOLIC_STRATEGY_H
+#define SYMBOLIC_STRATEGY_H
+
+#include "symbolic_core.h"
+#include "symbolic_feedback.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class GuessStrategy {
+public:
+    virtual ~GuessStrategy() = default;
+    virtual const char* name() const = 0;
+
+    // Dipanggil sekali di awal setiap permainan
+    virtual void reset(const GameConfig& config) { (void)config; }
+
+    // Mengembalikan tebakan berikutnya untuk status permainan saat ini
+    virtual std::string nextGuess(const GameCore& game, Rng& rng) = 0;
+};
+
+// Membuat strategi dari namanya; nullptr jika tidak dikenal
+std::unique_ptr<GuessStrategy> createStrategy(const std::string& name);
+std::vector<std::string> strategyNames();
+
+// Menyaring kandidat yang cocok dengan satu tebakan, hasil dan panahnya
+void filterCandidates(const PackedCandidates& source, const std::string& guess, const std::string& result,
+                      ArrowHint hint, PackedCandidates& out, std::vector<uint16_t>& codes);
+
+#endif
@@ -0,0 +1,177 @@
+#include "symbolic_terminal.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <conio.h>
+#include <windows.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+constexpr int SLEEP_TIMER = -1;
+constexpr size_t READ_CHUNK = 4096;
+
+#ifndef _WIN32
+// Dipakai dari handler sinyal, jadi hanya data statis dan fungsi yang aman untuk sinyal
+termios savedTermios;
+termios rawTermios;
+volatile sig_atomic_t rawActive = 0;
+bool handlersInstalled = false;
+
+void restoreTerminal() {
+    if (rawActive) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &savedTermios);
+        rawActive = 0;
+    }
+}
+
+void onSignal(int sig) {
+    bool wasRaw = rawActive;
+    restoreTerminal();
+    const char reset[] = "\033[0m";
+    if (write(STDOUT_FILENO, reset, sizeof reset - 1) < 0) {
+        // Tidak ada yang bisa dilakukan di dalam handler
+    }
+
+    // Sinyal sedang diblokir selama handler berjalan: buka dulu agar raise langsung berlaku
+    signal(sig, SIG_DFL);
+    sigset_t pending;
+    sigemptyset(&pending);
+    sigaddset(&pending, sig);
+    sigprocmask(SIG_UNBLOCK, &pending, nullptr);
+    raise(sig);
+
+    // Hanya SIGTSTP yang kembali ke sini (setelah SIGCONT): masuk raw mode lagi
+    signal(sig, onSignal);
+    if (wasRaw && tcsetattr(STDIN_FILENO, TCSANOW, &rawTermios) == 0) rawActive = 1;
+}
+
+void installHandlers() {
+    if (handlersInstalled) return;
+    handlersInstalled = true;
+    atexit(restoreTerminal);
+    for (int sig : {SIGINT, SIGTERM, SIGHUP, SIGQUIT, SIGTSTP}) signal(sig, onSignal);
+}
+#endif
+
+} // namespace
+
+void TerminalSession::enter() {
+#ifndef _WIN32
+    if (raw || !isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &savedTermios) < 0) return;
+    rawTermios = savedTermios;
+    rawTermios.c_lflag &= ~(ICANON | ECHO);
+    rawTermios.c_cc[VMIN] = 1;
+    rawTermios.c_cc[VTIME] = 0;
+    installHandlers();
+    if (tcsetattr(STDIN_FILENO, TCSANOW, &rawTermios) < 0) return;
+    rawActive = 1;
+#endif
+    raw = true;
+}
+
+void TerminalSession::restore() {
+    if (!raw) return;
+#ifndef _WIN32
+    restoreTerminal();
+#endif
+    raw = false;
+}
+
+void TerminalSession::setTimer(int id, Clock::duration delay) {
+    cancelTimer(id);
+    timers.push_back({id, Clock::now() + delay});
+}
+
+void TerminalSession::cancelTimer(int id) {
+    timers.erase(remove_if(timers.begin(), timers.end(), [id](const Timer& timer) { return timer.id == id; }),
+                 timers.end());
+}
+
+void TerminalSession::readAvailable() {
+#ifdef _WIN32
+    Clock::time_point now = Clock::now();
+    while (_kbhit()) keys.push_back({static_cast<char>(_getch()), now});
+#else
+    char buffer[READ_CHUNK];
+    ssize_t n = read(STDIN_FILENO, buffer, sizeof buffer);
+    if (n < 0 && errno == EINTR) return;
+    if (n <= 0) {
+        closed = true;
+        return;
+    }
+    Clock::time_point now = Clock::now();
+    for (ssize_t i = 0; i < n; i++) keys.push_back({buffer[i], now});
+#endif
+}
+
+TerminalSession::Wake TerminalSession::waitEvent(int& timerId, bool wantKeys) {
+    while (true) {
+        if (wantKeys && !keys.empty()) return Wake::INPUT;
+        if (wantKeys && closed) return Wake::CLOSED;
+
+        Clock::time_point now = Clock::now();
+        auto next = min_element(timers.begin(), timers.end(),
+                                [](const Timer& a, const Timer& b) { return a.deadline < b.deadline; });
+        if (next != timers.end() && next->deadline <= now) {
+            timerId = next->id;
+            timers.erase(next);
+            return Wake::TIMER;
+        }
+        int timeoutMs = -1;
+        if (next != timers.end()) {
+            auto remaining = chrono::duration_cast<chrono::milliseconds>(next->deadline - now).count() + 1;
+            timeoutMs = static_cast<int>(min<long long>(remaining, 60000));
+        }
+        if (timeoutMs < 0 && closed) return Wake::CLOSED; // Tidak ada yang bisa membangunkan lagi
+
+#ifdef _WIN32
+        if (_kbhit()) readAvailable();
+        else Sleep(timeoutMs < 0 ? 10 : min(timeoutMs, 10));
+#else
+        pollfd input = {STDIN_FILENO, POLLIN, 0};
+        int ready = poll(&input, closed ? 0 : 1, timeoutMs);
+        if (ready < 0 && errno != EINTR) closed = true;
+        else if (ready > 0) readAvailable();
+#endif
+    }
+}
+
+TerminalSession::Wake TerminalSession::wait(int& timerId) {
+    return waitEvent(timerId, true);
+}
+
+bool TerminalSession::popKey(Key& key) {
+    if (keys.empty()) return false;
+    key = keys.front();
+    keys.pop_front();
+    return true;
+}
+
+char TerminalSession::readKey() {
+    int timerId;
+    while (true) {
+        Wake wake = wait(timerId);
+        Key key;
+        if (wake == Wake::INPUT && popKey(key)) return key.ch;
+        if (wake == Wake::CLOSED) return '\0';
+        // Timer yang berakhir saat menunggu satu tombol diabaikan
+    }
+}
+
+void TerminalSession::sleepFor(Clock::duration delay) {
+    setTimer(SLEEP_TIMER, delay);
+    int timerId;
+    while (waitEvent(timerId, false) != Wake::TIMER || timerId != SLEEP_TIMER) {
+    }
+}
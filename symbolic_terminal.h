@@ -0,0 +1,76 @@
+/*
+ * SYMBOLIC NUMBLER - SESI TERMINAL (RAW MODE SEKALI) DENGAN TIMER
+ *
+ * Terminal masuk raw mode satu kali dan dipulihkan saat program keluar
+ * atau menerima sinyal. Input stdin dan timer monoton ditunggu bersama
+ * lewat poll; setiap kali bangun semua byte yang tersedia dibaca sekaligus
+ * sehingga digit yang ditempel diproses dalam satu frame. Setiap tombol
+ * membawa cap waktu steady_clock dari saat dibaca.
+ */
+#ifndef SYMBOLIC_TERMINAL_H
+#define SYMBOLIC_TERMINAL_H
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+class TerminalSession {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Wake {
+        INPUT,  // Ada tombol di antrean
+        TIMER,  // Timer berakhir (id di timerId)
+        CLOSED  // stdin ditutup (EOF)
+    };
+
+    struct Key {
+        char ch;
+        Clock::time_point at;
+    };
+
+private:
+    struct Timer {
+        int id;
+        Clock::time_point deadline;
+    };
+
+    std::deque<Key> keys;
+    std::vector<Timer> timers;
+    bool raw = false;
+    bool closed = false;
+
+    void readAvailable();
+    Wake waitEvent(int& timerId, bool wantKeys);
+
+public:
+    TerminalSession() = default;
+    ~TerminalSession() { restore(); }
+    TerminalSession(const TerminalSession&) = delete;
+    TerminalSession& operator=(const TerminalSession&) = delete;
+
+    // Masuk raw mode (tanpa ICANON/ECHO); tidak berbuat apa-apa jika stdin bukan TTY
+    void enter();
+    void restore();
+
+    // Timer sekali jalan; id yang sama menggantikan timer sebelumnya
+    void setTimer(int id, Clock::duration delay);
+    void cancelTimer(int id);
+
+    // Menunggu tombol atau timer pertama yang berakhir
+    Wake wait(int& timerId);
+
+    // Mengambil tombol berikutnya dari antrean (tidak memblokir)
+    bool popKey(Key& key);
+    bool hasKey() const { return !keys.empty(); }
+    bool isClosed() const { return closed && keys.empty(); }
+
+    // Menunggu satu tombol; '\0' jika stdin ditutup
+    char readKey();
+
+    // Menunggu tanpa memakai CPU; tombol yang masuk tetap di antrean
+    void sleepFor(Clock::duration delay);
+};
+
+#endif
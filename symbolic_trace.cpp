@@ -0,0 +1,221 @@
+#include "symbolic_trace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+atomic<bool> traceActive{false};
+
+namespace {
+
+const char* const PHASE_NAMES[TRACE_PHASE_COUNT] = {"input", "evaluateGuess", "candidates", "glyphs", "printInBorder", "flush",
+                                                   "keyToFrame"};
+
+#ifdef SYMBOLIC_TRACE
+/*
+ * HISTOGRAM LOG-LINEAR
+ * Nilai < 64 ns punya ember sendiri; di atasnya setiap pangkat dua dibagi
+ * 32 ember sama lebar. Batas atas 2^41 ns (~36 menit), sisanya dijepit.
+ */
+constexpr int SUB_BITS = 5;
+constexpr int SUB_COUNT = 1 << SUB_BITS;
+constexpr int MAX_EXPONENT = 40;
+constexpr int BUCKETS = 2 * SUB_COUNT + (MAX_EXPONENT - SUB_BITS) * SUB_COUNT;
+constexpr size_t EVENT_CAPACITY = 1 << 15; // Peristiwa terakhir per thread
+
+int bucketOf(uint64_t ns) {
+    if (ns < 2 * SUB_COUNT) return static_cast<int>(ns);
+    int exponent = 63;
+    while (!(ns >> exponent)) exponent--;
+    if (exponent > MAX_EXPONENT) return BUCKETS - 1;
+    int shift = exponent - SUB_BITS;
+    return 2 * SUB_COUNT + (exponent - SUB_BITS - 1) * SUB_COUNT + static_cast<int>((ns >> shift) - SUB_COUNT);
+}
+
+// Nilai tengah ember (untuk persentil)
+uint64_t bucketValue(int bucket) {
+    if (bucket < 2 * SUB_COUNT) return static_cast<uint64_t>(bucket);
+    int exponent = (bucket - 2 * SUB_COUNT) / SUB_COUNT + SUB_BITS + 1;
+    int shift = exponent - SUB_BITS;
+    uint64_t sub = static_cast<uint64_t>((bucket - 2 * SUB_COUNT) % SUB_COUNT + SUB_COUNT);
+    return (sub << shift) + (uint64_t{1} << shift) / 2;
+}
+
+struct TraceEvent {
+    uint64_t startNs; // Relatif terhadap traceEpoch
+    uint64_t durationNs;
+    TracePhase phase;
+};
+
+// Hanya thread pemiliknya yang menulis; pembaca memakai load relaxed
+struct ThreadTrace {
+    int tid;
+    atomic<uint64_t> counts[TRACE_PHASE_COUNT][BUCKETS];
+    atomic<uint64_t> maxNs[TRACE_PHASE_COUNT];
+    unique_ptr<TraceEvent[]> events{new TraceEvent[EVENT_CAPACITY]};
+    atomic<uint64_t> eventCount{0};
+
+    explicit ThreadTrace(int id) : tid(id) {
+        for (auto& phase : counts) {
+            for (auto& count : phase) count.store(0, memory_order_relaxed);
+        }
+        for (auto& value : maxNs) value.store(0, memory_order_relaxed);
+    }
+};
+
+// Daftar thread hanya bertambah; kunci hanya dipakai saat thread pertama kali mencatat
+mutex registryMutex;
+vector<unique_ptr<ThreadTrace>> registry;
+const TraceClock::time_point traceEpoch = TraceClock::now();
+string dumpPath;
+
+ThreadTrace& localTrace() {
+    thread_local ThreadTrace* local = nullptr;
+    if (!local) {
+        lock_guard<mutex> lock(registryMutex);
+        registry.push_back(make_unique<ThreadTrace>(static_cast<int>(registry.size()) + 1));
+        local = registry.back().get();
+    }
+    return *local;
+}
+
+void bump(atomic<uint64_t>& counter, uint64_t amount) {
+    counter.store(counter.load(memory_order_relaxed) + amount, memory_order_relaxed);
+}
+
+void dumpAtExit() {
+    traceActive.store(false, memory_order_relaxed);
+    if (!traceWriteChrome(dumpPath)) fprintf(stderr, "Tidak bisa menulis trace ke %s\n", dumpPath.c_str());
+}
+#endif
+
+} // namespace
+
+const char* tracePhaseName(TracePhase phase) {
+    int index = static_cast<int>(phase);
+    return index < TRACE_PHASE_COUNT ? PHASE_NAMES[index] : "?";
+}
+
+bool traceCompiled() {
+#ifdef SYMBOLIC_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+void traceEnable(bool enabled) {
+#ifdef SYMBOLIC_TRACE
+    traceActive.store(enabled, memory_order_relaxed);
+#else
+    (void)enabled;
+#endif
+}
+
+string traceStartFromEnv() {
+#ifdef SYMBOLIC_TRACE
+    const char* value = getenv("SYMBOLIC_TRACE");
+    if (!value || !*value || string(value) == "0") return "";
+    bool firstStart = dumpPath.empty();
+    dumpPath = string(value) == "1" ? "symbolic_trace.json" : value;
+    if (firstStart) atexit(dumpAtExit);
+    traceEnable(true);
+    return dumpPath;
+#else
+    return "";
+#endif
+}
+
+void traceRecord(TracePhase phase, TraceClock::time_point start, TraceClock::time_point end) {
+#ifdef SYMBOLIC_TRACE
+    if (!traceEnabled()) return;
+    ThreadTrace& local = localTrace();
+    int index = static_cast<int>(phase);
+    uint64_t ns = end > start ? static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(end - start).count()) : 0;
+    bump(local.counts[index][bucketOf(ns)], 1);
+    if (ns > local.maxNs[index].load(memory_order_relaxed)) local.maxNs[index].store(ns, memory_order_relaxed);
+
+    uint64_t slot = local.eventCount.load(memory_order_relaxed);
+    TraceEvent& event = local.events[slot % EVENT_CAPACITY];
+    event.startNs = start > traceEpoch ? static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(start - traceEpoch).count()) : 0;
+    event.durationNs = ns;
+    event.phase = phase;
+    local.eventCount.store(slot + 1, memory_order_release);
+#else
+    (void)phase;
+    (void)start;
+    (void)end;
+#endif
+}
+
+TraceSummary traceSummary(TracePhase phase) {
+    TraceSummary summary;
+#ifdef SYMBOLIC_TRACE
+    int index = static_cast<int>(phase);
+    vector<uint64_t> merged(BUCKETS, 0);
+    {
+        lock_guard<mutex> lock(registryMutex);
+        for (const auto& thread : registry) {
+            for (int b = 0; b < BUCKETS; b++) merged[b] += thread->counts[index][b].load(memory_order_relaxed);
+            summary.max = max(summary.max, thread->maxNs[index].load(memory_order_relaxed));
+        }
+    }
+    for (uint64_t count : merged) summary.count += count;
+    if (summary.count == 0) return summary;
+
+    // Peringkat terdekat: p50 adalah nilai ke-ceil(0.50 * n)
+    uint64_t rank50 = (summary.count * 50 + 99) / 100;
+    uint64_t rank99 = (summary.count * 99 + 99) / 100;
+    uint64_t seen = 0;
+    for (int b = 0; b < BUCKETS; b++) {
+        if (!merged[b]) continue;
+        seen += merged[b];
+        if (!summary.p50 && seen >= rank50) summary.p50 = min(bucketValue(b), summary.max);
+        if (seen >= rank99) {
+            summary.p99 = min(bucketValue(b), summary.max);
+            break;
+        }
+    }
+#else
+    (void)phase;
+#endif
+    return summary;
+}
+
+bool traceWriteChrome(const string& path) {
+#ifdef SYMBOLIC_TRACE
+    ofstream out(path);
+    if (!out) return false;
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    char line[160];
+    lock_guard<mutex> lock(registryMutex);
+    for (const auto& thread : registry) {
+        uint64_t total = thread->eventCount.load(memory_order_acquire);
+        uint64_t begin = total > EVENT_CAPACITY ? total - EVENT_CAPACITY : 0;
+        for (uint64_t i = begin; i < total; i++) {
+            const TraceEvent& event = thread->events[i % EVENT_CAPACITY];
+            // ts dan dur dalam mikrodetik dengan tiga desimal
+            snprintf(line, sizeof line,
+                     "%s\n{\"name\":\"%s\",\"cat\":\"symbolic\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%llu.%03llu,\"dur\":%llu.%03llu}",
+                     first ? "" : ",", tracePhaseName(event.phase), thread->tid,
+                     static_cast<unsigned long long>(event.startNs / 1000), static_cast<unsigned long long>(event.startNs % 1000),
+                     static_cast<unsigned long long>(event.durationNs / 1000),
+                     static_cast<unsigned long long>(event.durationNs % 1000));
+            out << line;
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+#else
+    (void)path;
+    return false;
+#endif
+}
@@ -0,0 +1,94 @@
+/*
+ * SYMBOLIC NUMBLER - PELACAKAN LATENSI JALUR PANAS
+ *
+ * Lingkup pengukuran kecil di sekitar input, evaluateGuess, penyusunan
+ * glif, printInBorder dan penulisan frame. Setiap thread mencatat ke
+ * histogram log-linear (gaya HDR, galat < 3.2%) miliknya sendiri tanpa
+ * kunci; pembaca menggabungkan semua thread saat diminta. Peristiwa
+ * terakhir setiap thread juga disimpan di cincin untuk dibuang sebagai
+ * JSON trace-event Chrome (chrome://tracing, Perfetto) saat keluar.
+ *
+ * Tanpa SYMBOLIC_TRACE saat kompilasi semua lingkup hilang sama sekali;
+ * jika dikompilasi tetapi tidak aktif, biayanya satu load atomik relaxed.
+ */
+#ifndef SYMBOLIC_TRACE_H
+#define SYMBOLIC_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+enum class TracePhase : uint8_t {
+    INPUT,           // Tombol tiba sampai mulai diproses
+    EVALUATE,        // evaluateGuess saat tebakan dikirim
+    CANDIDATES,      // Menyaring pelacak kandidat dengan tebakan baru
+    GLYPHS,          // Menyusun baris glif satu angka
+    PRINT_IN_BORDER, // Satu baris berbingkai
+    FLUSH,           // Menulis frame ke terminal
+    FRAME,           // Tombol tiba sampai frame selesai ditulis
+    COUNT
+};
+
+constexpr int TRACE_PHASE_COUNT = static_cast<int>(TracePhase::COUNT);
+
+const char* tracePhaseName(TracePhase phase);
+
+// Ringkasan histogram gabungan semua thread, dalam nanodetik
+struct TraceSummary {
+    uint64_t count = 0;
+    uint64_t p50 = 0;
+    uint64_t p99 = 0;
+    uint64_t max = 0;
+};
+
+using TraceClock = std::chrono::steady_clock;
+
+extern std::atomic<bool> traceActive;
+
+inline bool traceEnabled() { return traceActive.load(std::memory_order_relaxed); }
+
+// true jika pelacakan ikut dikompilasi
+bool traceCompiled();
+
+// Menghidupkan/mematikan pencatatan saat runtime (tanpa efek jika tidak dikompilasi)
+void traceEnable(bool enabled);
+
+// SYMBOLIC_TRACE=FILE menghidupkan pencatatan dan membuang trace ke FILE saat keluar
+// ("1" berarti symbolic_trace.json); mengembalikan path tujuan atau string kosong
+std::string traceStartFromEnv();
+
+// Mencatat satu interval ke histogram dan cincin peristiwa thread ini
+void traceRecord(TracePhase phase, TraceClock::time_point start, TraceClock::time_point end);
+
+TraceSummary traceSummary(TracePhase phase);
+
+// Menulis peristiwa yang tersimpan sebagai JSON trace-event Chrome
+bool traceWriteChrome(const std::string& path);
+
+#ifdef SYMBOLIC_TRACE
+class TraceScope {
+private:
+    TracePhase phase;
+    bool active;
+    TraceClock::time_point start;
+
+public:
+    explicit TraceScope(TracePhase tracePhase) : phase(tracePhase), active(traceEnabled()) {
+        if (active) start = TraceClock::now();
+    }
+    ~TraceScope() {
+        if (active) traceRecord(phase, start, TraceClock::now());
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+#define SYMBOLIC_TRACE_CONCAT_(a, b) a##b
+#define SYMBOLIC_TRACE_CONCAT(a, b) SYMBOLIC_TRACE_CONCAT_(a, b)
+#define SYMBOLIC_TRACE_SCOPE(phase) TraceScope SYMBOLIC_TRACE_CONCAT(traceScope_, __LINE__)(phase)
+#else
+#define SYMBOLIC_TRACE_SCOPE(phase) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,176 @@
+/*
+ * SYMBOLIC NUMBLER - PENONTON SIARAN
+ *
+ * Contoh:
+ *   SYMBOLIC_BROADCAST=1 ./symbolic         (terminal pemain)
+ *   symbolic_watch                          (sebanyak apa pun terminal penonton)
+ *   symbolic_watch --stats                  (jeda dan frame yang dilewati setiap penonton)
+ *
+ * Penonton selalu menggambar frame terbaru; jika terminalnya lambat frame
+ * di antaranya dilewati, pemain tidak pernah ikut melambat. Saat pemain
+ * keluar penonton menunggu siaran berikutnya di path yang sama.
+ */
+#include "symbolic_broadcast.h"
+#include "symbolic_screen.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+struct Options {
+    string path = defaultBroadcastPath();
+    bool stats = false;
+    bool status = true;
+};
+
+constexpr int WAIT_MS = 100;     // Batas tidur menunggu frame (pemeriksaan Ctrl-C dan pemain hilang)
+constexpr int REOPEN_MS = 500;   // Jeda mencoba membuka siaran yang belum ada
+
+atomic<bool> stopRequested{false};
+
+void requestStop(int) {
+    stopRequested.store(true);
+}
+
+void printUsage(const char* program) {
+    cout << "Penggunaan: " << program << " [opsi]\n"
+         << "  --file F       File siaran (bawaan: " << defaultBroadcastPath() << ")\n"
+         << "  --stats        Menampilkan statistik siaran dan semua penonton lalu keluar\n"
+         << "  --no-status    Tanpa baris status di bawah papan\n";
+}
+
+double toMs(uint64_t ns) {
+    return static_cast<double>(ns) / 1e6;
+}
+
+int showStats(const Options& options) {
+    BroadcastViewer viewer;
+    if (!viewer.open(options.path, false)) {
+        cerr << "Tidak ada siaran di " << options.path << "\n";
+        return 1;
+    }
+    BroadcastStats stats = viewer.stats();
+    cout << "Siaran    : " << options.path << (stats.live ? " (langsung)" : " (selesai)") << "\n"
+         << "Frame     : " << stats.published << " (" << stats.truncated << " dipotong)\n"
+         << "Penonton  : " << stats.viewers.size() << "\n";
+    if (stats.viewers.empty()) return 0;
+    cout << setw(8) << "PID" << setw(10) << "Tampil" << setw(10) << "Dilewati" << setw(12) << "Tertinggal"
+         << setw(12) << "Jeda ms" << setw(12) << "Rata2 ms" << setw(12) << "Maks ms" << "\n";
+    for (const ViewerStats& row : stats.viewers) {
+        cout << setw(8) << row.pid << setw(10) << row.shown << setw(10) << row.skipped << setw(12)
+             << stats.published - row.lastFrame << fixed << setprecision(2) << setw(12) << toMs(row.lastLagNs)
+             << setw(12) << toMs(row.meanLagNs()) << setw(12) << toMs(row.maxLagNs) << "\n";
+    }
+    return 0;
+}
+
+// Tinggi terminal penonton, 0 jika tidak diketahui; frame pemain dipotong menurut ini
+size_t terminalRows() {
+#ifndef _WIN32
+    struct winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0) return size.ws_row;
+#endif
+    return 0;
+}
+
+// Baris status di bawah frame: tertinggal berapa frame dan jeda frame sebelumnya
+void appendStatus(ScreenBuffer& screen, const BroadcastViewer& viewer) {
+    const ViewerStats& own = viewer.ownStats();
+    uint64_t lagUs = own.lastLagNs / 1000;
+    screen.newLine() << "\033[36m" << "Menonton " << viewer.getPath() << " | frame " << viewer.latestFrame()
+                     << " | dilewati " << own.skipped << " | jeda " << lagUs / 1000 << "." << lagUs / 100 % 10
+                     << " ms" << "\033[0m";
+}
+
+// Ringkasan saat keluar mencakup semua siaran yang sudah ditonton
+void addTotals(ViewerStats& total, const ViewerStats& own) {
+    total.shown += own.shown;
+    total.skipped += own.skipped;
+    total.totalLagNs += own.totalLagNs;
+    total.maxLagNs = max(total.maxLagNs, own.maxLagNs);
+}
+
+int watch(const Options& options) {
+    signal(SIGINT, requestStop);
+    signal(SIGTERM, requestStop);
+
+    ScreenBuffer screen;
+    BroadcastViewer viewer;
+    ViewerStats total;
+    bool waitingShown = false;
+    while (!stopRequested.load()) {
+        if (!viewer.isOpen()) {
+            if (!viewer.open(options.path)) {
+                if (!waitingShown) {
+                    screen.invalidate();
+                    screen.beginFrame();
+                    screen.addLine("Menunggu siaran di " + options.path + " ... (Ctrl-C untuk keluar)");
+                    screen.present();
+                    waitingShown = true;
+                }
+                this_thread::sleep_for(chrono::milliseconds(REOPEN_MS));
+                continue;
+            }
+            waitingShown = false;
+            screen.invalidate();
+        }
+
+        BroadcastViewer::Wait wake = viewer.wait(chrono::milliseconds(WAIT_MS));
+        if (wake == BroadcastViewer::Wait::ENDED) {
+            // Siaran berikutnya di path yang sama dibuka saat pemain mulai lagi
+            addTotals(total, viewer.ownStats());
+            viewer.close();
+            continue;
+        }
+        if (wake != BroadcastViewer::Wait::FRAME || !viewer.read(screen)) continue;
+        if (options.status) appendStatus(screen, viewer);
+        screen.setHeight(terminalRows());
+        screen.present();
+        viewer.shown();
+    }
+
+    addTotals(total, viewer.ownStats());
+    cout << "\033[0m\n"
+         << total.shown << " frame tampil, " << total.skipped << " dilewati, jeda rata-rata " << fixed
+         << setprecision(2) << toMs(total.meanLagNs()) << " ms, maks " << toMs(total.maxLagNs) << " ms\n";
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--file") == 0 && hasValue) options.path = argv[++i];
+        else if (strcmp(arg, "--stats") == 0) options.stats = true;
+        else if (strcmp(arg, "--no-status") == 0) options.status = false;
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+#ifdef _WIN32
+    cerr << "Siaran memakai memori bersama POSIX dan belum tersedia di Windows\n";
+    return 1;
+#else
+    return options.stats ? showStats(options) : watch(options);
+#endif
+}